@@ -0,0 +1,133 @@
+/**
+ * @file Benchmark.hpp
+ * @author paul
+ * @date 17.10.26
+ * @brief Minimal harness for comparing kernels on SI types against the same kernels on the underlying type.
+ * @ingroup SI
+ */
+#ifndef SI_BENCHMARK_HPP
+#define SI_BENCHMARK_HPP
+
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <cstdio>
+#include <string>
+#include <vector>
+
+namespace bench {
+    /**
+     * Prevent the compiler from removing the computation of a value.
+     * @tparam T the type of the value
+     * @param val the value, considered to be read by the barrier
+     */
+    template<typename T>
+    inline void doNotOptimize(const T &val) {
+#if defined(__GNUC__) || defined(__clang__)
+        asm volatile("" : : "r,m"(val) : "memory");
+#else
+        static const void *volatile sink;
+        sink = &val;
+#endif
+    }
+
+    /**
+     * Force all pending writes to memory to be considered observable.
+     */
+    inline void clobberMemory() {
+#if defined(__GNUC__) || defined(__clang__)
+        asm volatile("" : : : "memory");
+#endif
+    }
+
+    /**
+     * Measure the time of a kernel processing a fixed number of elements. The number of repetitions is increased
+     * until a single measurement takes at least minTime, the best of all measurements is reported.
+     * @tparam F the type of the kernel
+     * @param kernel the kernel, every call processes all elements once
+     * @param elements the number of elements processed per call
+     * @return the time per element in nanoseconds
+     */
+    template<typename F>
+    auto measure(F &&kernel, std::size_t elements) -> double {
+        using Clock = std::chrono::steady_clock;
+        constexpr auto minTime = std::chrono::milliseconds{20};
+        constexpr int samples = 5;
+
+        std::size_t reps = 1;
+        for (;;) {
+            auto begin = Clock::now();
+            for (std::size_t i = 0; i < reps; ++i) {
+                kernel();
+                clobberMemory();
+            }
+            if (Clock::now() - begin >= minTime) {
+                break;
+            }
+            reps *= 2;
+        }
+
+        auto best = Clock::duration::max();
+        for (int sample = 0; sample < samples; ++sample) {
+            auto begin = Clock::now();
+            for (std::size_t i = 0; i < reps; ++i) {
+                kernel();
+                clobberMemory();
+            }
+            best = std::min(best, Clock::now() - begin);
+        }
+        return std::chrono::duration<double, std::nano>{best}.count() / static_cast<double>(reps * elements);
+    }
+
+    /**
+     * Result of comparing a kernel on SI types with the kernel on the underlying type.
+     */
+    struct Result {
+        std::string name;  ///< Name of the kernel
+        std::string type;  ///< Name of the underlying type
+        std::size_t size;  ///< Number of elements
+        double siNs;       ///< Time per element using SI types in nanoseconds
+        double rawNs;      ///< Time per element using the underlying type in nanoseconds
+    };
+
+    /**
+     * Collection of all results, printed as table.
+     */
+    class Report {
+      public:
+        /**
+         * Measure a kernel on SI types and on the underlying type and store the result.
+         * @tparam SiKernel the type of the kernel using SI types
+         * @tparam RawKernel the type of the kernel using the underlying type
+         * @param name the name of the kernel
+         * @param type the name of the underlying type
+         * @param size the number of elements processed per call of the kernels
+         * @param siKernel the kernel using SI types
+         * @param rawKernel the kernel using the underlying type
+         */
+        template<typename SiKernel, typename RawKernel>
+        void add(std::string name, std::string type, std::size_t size, SiKernel &&siKernel, RawKernel &&rawKernel) {
+            auto rawNs = measure(rawKernel, size);
+            auto siNs = measure(siKernel, size);
+            results.push_back({std::move(name), std::move(type), size, siNs, rawNs});
+        }
+
+        /**
+         * Print all results, the throughput is given in million elements per second, a ratio of more than one
+         * means that the SI version is slower than the raw version.
+         */
+        void print() const {
+            std::printf("%-12s %-7s %9s %14s %14s %7s\n", "kernel", "type", "size", "si [Melem/s]", "raw [Melem/s]",
+                        "ratio");
+            for (const auto &result : results) {
+                std::printf("%-12s %-7s %9zu %14.1f %14.1f %7.3f\n", result.name.c_str(), result.type.c_str(),
+                            result.size, 1e3 / result.siNs, 1e3 / result.rawNs, result.siNs / result.rawNs);
+            }
+        }
+
+      private:
+        std::vector<Result> results;
+    };
+} // namespace bench
+
+#endif
@@ -0,0 +1,220 @@
+/**
+ * @file main.cpp
+ * @author paul
+ * @date 17.10.26
+ * @brief Benchmark of the SI types against the underlying types, run the si_bench target in release mode.
+ * @ingroup SI
+ */
+#include <cmath>
+#include <cstddef>
+#include <random>
+#include <sstream>
+#include <vector>
+
+#include <SI/Si.hpp>
+
+#include "Benchmark.hpp"
+
+namespace {
+    /**
+     * Input and output data of a kernel, both as SI types and as underlying type with the same values.
+     * @tparam T the underlying type
+     */
+    template<typename T>
+    struct Data {
+        std::vector<si::Meter<T>> meter;                  ///< Positive values with unit
+        std::vector<si::Second<T>> second;                ///< Positive values with unit
+        std::vector<si::Si<2, 0, 0, 0, 0, 0, 0, T>> area; ///< Positive values with unit (square meter)
+        std::vector<si::Meter<T>> signedMeter;            ///< Values with both signs
+        std::vector<T> rawMeter;                          ///< Same values as meter
+        std::vector<T> rawSecond;                         ///< Same values as second
+        std::vector<T> rawArea;                           ///< Same values as area
+        std::vector<T> rawSignedMeter;                    ///< Same values as signedMeter
+
+        /**
+         * Create random data.
+         * @param size the number of elements
+         */
+        explicit Data(std::size_t size) {
+            std::mt19937 gen{42}; // NOLINT(cert-msc32-c,cert-msc51-cpp) reproducible data
+            std::uniform_real_distribution<T> positive{T{1}, T{100}};
+            std::uniform_real_distribution<T> any{T{-100}, T{100}};
+            for (std::size_t i = 0; i < size; ++i) {
+                rawMeter.push_back(positive(gen));
+                rawSecond.push_back(positive(gen));
+                rawArea.push_back(positive(gen));
+                rawSignedMeter.push_back(any(gen));
+                meter.emplace_back(rawMeter.back());
+                second.emplace_back(rawSecond.back());
+                area.emplace_back(rawArea.back());
+                signedMeter.emplace_back(rawSignedMeter.back());
+            }
+        }
+    };
+
+    /**
+     * Benchmark all kernels for one underlying type and one size.
+     * @tparam T the underlying type
+     * @param report the report to add the results to
+     * @param type the name of the underlying type
+     * @param size the number of elements
+     */
+    template<typename T>
+    void benchmark(bench::Report &report, const char *type, std::size_t size) {
+        Data<T> data{size};
+        std::vector<si::Meter<T>> meterOut(size);
+        std::vector<si::Speed<T>> speedOut(size);
+        std::vector<T> rawOut(size);
+
+        report.add(
+                "add", type, size,
+                [&] {
+                    for (std::size_t i = 0; i < size; ++i) {
+                        meterOut[i] = data.meter[i] + data.signedMeter[i];
+                    }
+                },
+                [&] {
+                    for (std::size_t i = 0; i < size; ++i) {
+                        rawOut[i] = data.rawMeter[i] + data.rawSignedMeter[i];
+                    }
+                });
+
+        report.add(
+                "divide", type, size,
+                [&] {
+                    for (std::size_t i = 0; i < size; ++i) {
+                        speedOut[i] = data.meter[i] / data.second[i];
+                    }
+                },
+                [&] {
+                    for (std::size_t i = 0; i < size; ++i) {
+                        rawOut[i] = data.rawMeter[i] / data.rawSecond[i];
+                    }
+                });
+
+        report.add(
+                "scale", type, size,
+                [&] {
+                    for (std::size_t i = 0; i < size; ++i) {
+                        meterOut[i] = data.meter[i] * T{2} - data.signedMeter[i] / T{4};
+                    }
+                },
+                [&] {
+                    for (std::size_t i = 0; i < size; ++i) {
+                        rawOut[i] = data.rawMeter[i] * T{2} - data.rawSignedMeter[i] / T{4};
+                    }
+                });
+
+        report.add(
+                "compare", type, size,
+                [&] {
+                    std::size_t count = 0;
+                    for (std::size_t i = 0; i < size; ++i) {
+                        count += data.meter[i] < data.signedMeter[i] ? 1 : 0;
+                    }
+                    bench::doNotOptimize(count);
+                },
+                [&] {
+                    std::size_t count = 0;
+                    for (std::size_t i = 0; i < size; ++i) {
+                        count += data.rawMeter[i] < data.rawSignedMeter[i] ? 1 : 0;
+                    }
+                    bench::doNotOptimize(count);
+                });
+
+        report.add(
+                "scalar", type, size,
+                [&] {
+                    T sum{};
+                    for (std::size_t i = 0; i < size; ++i) {
+                        sum += static_cast<T>(data.meter[i] / data.signedMeter[i]);
+                    }
+                    bench::doNotOptimize(sum);
+                },
+                [&] {
+                    T sum{};
+                    for (std::size_t i = 0; i < size; ++i) {
+                        sum += data.rawMeter[i] / data.rawSignedMeter[i];
+                    }
+                    bench::doNotOptimize(sum);
+                });
+
+        report.add(
+                "sqrt", type, size,
+                [&] {
+                    for (std::size_t i = 0; i < size; ++i) {
+                        meterOut[i] = std::sqrt(data.area[i]);
+                    }
+                },
+                [&] {
+                    for (std::size_t i = 0; i < size; ++i) {
+                        rawOut[i] = std::sqrt(data.rawArea[i]);
+                    }
+                });
+
+        report.add(
+                "abs", type, size,
+                [&] {
+                    for (std::size_t i = 0; i < size; ++i) {
+                        meterOut[i] = std::abs(data.signedMeter[i]);
+                    }
+                },
+                [&] {
+                    for (std::size_t i = 0; i < size; ++i) {
+                        rawOut[i] = std::abs(data.rawSignedMeter[i]);
+                    }
+                });
+
+        report.add(
+                "round", type, size,
+                [&] {
+                    for (std::size_t i = 0; i < size; ++i) {
+                        meterOut[i] = std::round(data.signedMeter[i]);
+                    }
+                },
+                [&] {
+                    for (std::size_t i = 0; i < size; ++i) {
+                        rawOut[i] = std::round(data.rawSignedMeter[i]);
+                    }
+                });
+
+        report.add(
+                "atan2", type, size,
+                [&] {
+                    for (std::size_t i = 0; i < size; ++i) {
+                        rawOut[i] = std::atan2(data.signedMeter[i], data.meter[i]);
+                    }
+                },
+                [&] {
+                    for (std::size_t i = 0; i < size; ++i) {
+                        rawOut[i] = std::atan2(data.rawSignedMeter[i], data.rawMeter[i]);
+                    }
+                });
+
+        std::ostringstream stream;
+        report.add(
+                "print", type, size,
+                [&] {
+                    stream.str({});
+                    for (std::size_t i = 0; i < size; ++i) {
+                        stream << data.meter[i] / data.second[i] << '\n';
+                    }
+                },
+                [&] {
+                    stream.str({});
+                    for (std::size_t i = 0; i < size; ++i) {
+                        stream << data.rawMeter[i] / data.rawSecond[i] << " m / s" << '\n';
+                    }
+                });
+    }
+} // namespace
+
+auto main() -> int {
+    bench::Report report;
+    for (std::size_t size : {16U, 1024U, 65536U, 1048576U}) {
+        benchmark<double>(report, "double", size);
+        benchmark<float>(report, "float", size);
+    }
+    report.print();
+    return 0;
+}
@@ -15,6 +15,7 @@
 
 #include "SiBase.hpp"
 #include "SiExtended.hpp"
+#include "SiFormat.hpp"
 #include "SiPrinter.hpp"
 #include "SiPrinterExtended.hpp"
 #include "SiStl.hpp"
@@ -0,0 +1,444 @@
+/**
+ * @file SiAlgorithm.hpp
+ * @author paul
+ * @date 17.10.26
+ * @brief Reductions (sum, transformed sum, inner product) over spans of SI values, optionally with compensated
+ * summation and in parallel. Requires C++20.
+ * @ingroup SI
+ */
+#ifndef SI_SIALGORITHM_HPP
+#define SI_SIALGORITHM_HPP
+
+#include <cassert>
+#include <cstddef>
+#include <span>
+#include <thread>
+#include <type_traits>
+#include <utility>
+#include <vector>
+#include <version>
+
+#ifdef __cpp_lib_execution
+    #include <execution>
+    #include <numeric>
+#endif
+
+#include "SiImpl.hpp"
+#include "SiSpan.hpp"
+
+namespace si {
+    /**
+     * Plain summation, the error grows with the number of values.
+     * @tparam T the type of the summands
+     */
+    template<typename T>
+    class NaiveSum {
+      public:
+        /**
+         * Add a value.
+         * @param val the summand
+         */
+        constexpr void add(T val) noexcept {
+            sum_ += val;
+        }
+
+        /**
+         * Add the sum of another accumulator.
+         * @param other the other accumulator
+         */
+        constexpr void merge(const NaiveSum &other) noexcept {
+            sum_ += other.sum_;
+        }
+
+        /**
+         * The sum of all values.
+         * @return the sum
+         */
+        [[nodiscard]] constexpr auto result() const noexcept -> T {
+            return sum_;
+        }
+
+      private:
+        T sum_{0};
+    };
+
+    /**
+     * Compensated summation (Kahan-Babuska-Neumaier): the rounding error of every addition is accumulated separately,
+     * the error of the result does not grow with the number of values. About four times slower than NaiveSum.
+     * @tparam T the type of the summands
+     */
+    template<typename T>
+    class NeumaierSum {
+      public:
+        /**
+         * Add a value.
+         * @param val the summand
+         */
+        constexpr void add(T val) noexcept {
+            auto sum = sum_ + val;
+            auto absSum = sum_ < T{0} ? -sum_ : sum_;
+            auto absVal = val < T{0} ? -val : val;
+            compensation_ += absSum >= absVal ? (sum_ - sum) + val : (val - sum) + sum_;
+            sum_ = sum;
+        }
+
+        /**
+         * Add the sum of another accumulator.
+         * @param other the other accumulator
+         */
+        constexpr void merge(const NeumaierSum &other) noexcept {
+            add(other.sum_);
+            compensation_ += other.compensation_;
+        }
+
+        /**
+         * The sum of all values.
+         * @return the sum
+         */
+        [[nodiscard]] constexpr auto result() const noexcept -> T {
+            return sum_ + compensation_;
+        }
+
+      private:
+        T sum_{0};
+        T compensation_{0};
+    };
+
+    /**
+     * Execution policy which splits the range into one chunk per thread, the partial results are combined in a fixed
+     * order so the result only depends on the number of threads.
+     */
+    struct ThreadPolicy {
+        unsigned threads = 0;             ///< Number of threads, 0 uses std::thread::hardware_concurrency()
+        std::size_t minChunk = 1U << 16U; ///< Minimal number of values per thread
+    };
+
+    namespace detail {
+        /**
+         * Unit of the sum of the results of op.
+         */
+        template<typename Op, typename... SiTs>
+        using ReduceResult = std::remove_cvref_t<std::invoke_result_t<Op &, SiTs...>>;
+
+        /**
+         * Accumulator for the underlying values of a sum with the unit SiT.
+         */
+        template<template<typename> class Accumulator, typename SiT>
+        using AccumulatorFor = Accumulator<typename ComputeType<typename SiT::type>::type>;
+
+        /**
+         * Accumulate the values map(i) for i in [begin, end).
+         */
+        template<typename Acc, typename Map>
+        auto accumulate(std::size_t begin, std::size_t end, Map &map) -> Acc {
+            Acc acc;
+            for (std::size_t i = begin; i < end; ++i) {
+                acc.add(map(i));
+            }
+            return acc;
+        }
+
+        /**
+         * Accumulate the values map(i) for i in [0, size) using multiple threads.
+         */
+        template<typename Acc, typename Map>
+        auto accumulate(const ThreadPolicy &policy, std::size_t size, Map &map) -> Acc {
+            std::size_t threads = policy.threads != 0 ? policy.threads : std::thread::hardware_concurrency();
+            auto minChunk = policy.minChunk != 0 ? policy.minChunk : 1;
+            auto maxThreads = (size + minChunk - 1) / minChunk;
+            threads = threads < maxThreads ? threads : maxThreads;
+            if (threads <= 1) {
+                return accumulate<Acc>(0, size, map);
+            }
+
+            std::vector<Acc> partial(threads);
+            {
+                std::vector<std::jthread> workers;
+                workers.reserve(threads - 1);
+                for (std::size_t t = 1; t < threads; ++t) {
+                    workers.emplace_back([&partial, &map, t, threads, size] {
+                        partial[t] = accumulate<Acc>(size * t / threads, size * (t + 1) / threads, map);
+                    });
+                }
+                partial[0] = accumulate<Acc>(0, size / threads, map);
+            } // Joins all workers
+            for (std::size_t t = 1; t < threads; ++t) {
+                partial[0].merge(partial[t]);
+            }
+            return partial[0];
+        }
+    } // namespace detail
+
+    /**
+     * Sum of SI values.
+     * @tparam Accumulator the summation algorithm, e.g. NaiveSum or NeumaierSum
+     * @tparam SiT the (possibly const) SI type
+     * @tparam Extent the extent of the span
+     * @param vals the values
+     * @return the sum
+     */
+    template<template<typename> class Accumulator = NaiveSum, typename SiT, std::size_t Extent>
+    auto reduce(std::span<SiT, Extent> vals) -> std::remove_const_t<SiT> {
+        return reduce<Accumulator>(ThreadPolicy{1}, vals);
+    }
+
+    /**
+     * Sum of SI values using multiple threads.
+     * @tparam Accumulator the summation algorithm, e.g. NaiveSum or NeumaierSum
+     * @tparam SiT the (possibly const) SI type
+     * @tparam Extent the extent of the span
+     * @param policy the number of threads
+     * @param vals the values
+     * @return the sum
+     */
+    template<template<typename> class Accumulator = NaiveSum, typename SiT, std::size_t Extent>
+    auto reduce(const ThreadPolicy &policy, std::span<SiT, Extent> vals) -> std::remove_const_t<SiT> {
+        using Res = std::remove_const_t<SiT>;
+        static_assert(IsSi<Res>::val, "reduce requires a span of SI values");
+        auto raw = asRaw(vals);
+        auto map = [raw](std::size_t i) { return raw[i]; };
+        auto acc = detail::accumulate<detail::AccumulatorFor<Accumulator, Res>>(policy, raw.size(), map);
+        return Res{static_cast<typename Res::type>(acc.result())};
+    }
+
+    /**
+     * Sum of the transformed SI values, the unit of the result is the unit returned by op.
+     * @tparam Accumulator the summation algorithm, e.g. NaiveSum or NeumaierSum
+     * @tparam SiT the (possibly const) SI type
+     * @tparam Extent the extent of the span
+     * @tparam Op the type of the transformation
+     * @param vals the values
+     * @param op the transformation, needs to return an SI type
+     * @return the sum of op(vals[i])
+     */
+    template<template<typename> class Accumulator = NaiveSum, typename SiT, std::size_t Extent, typename Op>
+    auto transform_reduce(std::span<SiT, Extent> vals, Op op) -> detail::ReduceResult<Op, SiT &> {
+        return transform_reduce<Accumulator>(ThreadPolicy{1}, vals, op);
+    }
+
+    /**
+     * Sum of the transformed SI values using multiple threads, the unit of the result is the unit returned by op.
+     * @tparam Accumulator the summation algorithm, e.g. NaiveSum or NeumaierSum
+     * @tparam SiT the (possibly const) SI type
+     * @tparam Extent the extent of the span
+     * @tparam Op the type of the transformation
+     * @param policy the number of threads
+     * @param vals the values
+     * @param op the transformation, needs to return an SI type and be callable from multiple threads
+     * @return the sum of op(vals[i])
+     */
+    template<template<typename> class Accumulator = NaiveSum, typename SiT, std::size_t Extent, typename Op>
+    auto transform_reduce(const ThreadPolicy &policy, std::span<SiT, Extent> vals, Op op)
+            -> detail::ReduceResult<Op, SiT &> {
+        using Res = detail::ReduceResult<Op, SiT &>;
+        static_assert(IsSi<Res>::val, "The transformation needs to return an SI type");
+        auto map = [vals, &op](std::size_t i) { return static_cast<typename Res::type>(op(vals[i])); };
+        auto acc = detail::accumulate<detail::AccumulatorFor<Accumulator, Res>>(policy, vals.size(), map);
+        return Res{static_cast<typename Res::type>(acc.result())};
+    }
+
+    /**
+     * Sum of the transformed pairs of SI values, the unit of the result is the unit returned by op.
+     * @tparam Accumulator the summation algorithm, e.g. NaiveSum or NeumaierSum
+     * @tparam SiT1 the (possibly const) SI type of the first span
+     * @tparam Extent1 the extent of the first span
+     * @tparam SiT2 the (possibly const) SI type of the second span
+     * @tparam Extent2 the extent of the second span
+     * @tparam Op the type of the transformation
+     * @param policy the number of threads
+     * @param lhs the first values
+     * @param rhs the second values, needs to have the same size as lhs
+     * @param op the transformation, needs to return an SI type and be callable from multiple threads
+     * @return the sum of op(lhs[i], rhs[i])
+     */
+    template<template<typename> class Accumulator = NaiveSum, typename SiT1, std::size_t Extent1, typename SiT2,
+             std::size_t Extent2, typename Op>
+    auto transform_reduce(const ThreadPolicy &policy, std::span<SiT1, Extent1> lhs, std::span<SiT2, Extent2> rhs,
+                          Op op) -> detail::ReduceResult<Op, SiT1 &, SiT2 &> {
+        using Res = detail::ReduceResult<Op, SiT1 &, SiT2 &>;
+        static_assert(IsSi<Res>::val, "The transformation needs to return an SI type");
+        assert(lhs.size() == rhs.size() && "Both spans need to have the same size");
+        auto map = [lhs, rhs, &op](std::size_t i) { return static_cast<typename Res::type>(op(lhs[i], rhs[i])); };
+        auto acc = detail::accumulate<detail::AccumulatorFor<Accumulator, Res>>(policy, lhs.size(), map);
+        return Res{static_cast<typename Res::type>(acc.result())};
+    }
+
+    /**
+     * Sum of the transformed pairs of SI values, the unit of the result is the unit returned by op.
+     * @tparam Accumulator the summation algorithm, e.g. NaiveSum or NeumaierSum
+     * @tparam SiT1 the (possibly const) SI type of the first span
+     * @tparam Extent1 the extent of the first span
+     * @tparam SiT2 the (possibly const) SI type of the second span
+     * @tparam Extent2 the extent of the second span
+     * @tparam Op the type of the transformation
+     * @param lhs the first values
+     * @param rhs the second values, needs to have the same size as lhs
+     * @param op the transformation, needs to return an SI type
+     * @return the sum of op(lhs[i], rhs[i])
+     */
+    template<template<typename> class Accumulator = NaiveSum, typename SiT1, std::size_t Extent1, typename SiT2,
+             std::size_t Extent2, typename Op>
+    auto transform_reduce(std::span<SiT1, Extent1> lhs, std::span<SiT2, Extent2> rhs, Op op)
+            -> detail::ReduceResult<Op, SiT1 &, SiT2 &> {
+        return transform_reduce<Accumulator>(ThreadPolicy{1}, lhs, rhs, op);
+    }
+
+    /**
+     * Inner product of two spans of SI values, the unit is the product of the units (e.g. Speed and Second result
+     * in Meter).
+     * @tparam Accumulator the summation algorithm, e.g. NaiveSum or NeumaierSum
+     * @tparam SiT1 the (possibly const) SI type of the first span
+     * @tparam Extent1 the extent of the first span
+     * @tparam SiT2 the (possibly const) SI type of the second span
+     * @tparam Extent2 the extent of the second span
+     * @param policy the number of threads
+     * @param lhs the first values
+     * @param rhs the second values, needs to have the same size as lhs
+     * @return the sum of lhs[i] * rhs[i]
+     */
+    template<template<typename> class Accumulator = NaiveSum, typename SiT1, std::size_t Extent1, typename SiT2,
+             std::size_t Extent2>
+    auto inner_product(const ThreadPolicy &policy, std::span<SiT1, Extent1> lhs, std::span<SiT2, Extent2> rhs) {
+        return transform_reduce<Accumulator>(policy, lhs, rhs, [](auto a, auto b) { return a * b; });
+    }
+
+    /**
+     * Inner product of two spans of SI values, the unit is the product of the units (e.g. Speed and Second result
+     * in Meter).
+     * @tparam Accumulator the summation algorithm, e.g. NaiveSum or NeumaierSum
+     * @tparam SiT1 the (possibly const) SI type of the first span
+     * @tparam Extent1 the extent of the first span
+     * @tparam SiT2 the (possibly const) SI type of the second span
+     * @tparam Extent2 the extent of the second span
+     * @param lhs the first values
+     * @param rhs the second values, needs to have the same size as lhs
+     * @return the sum of lhs[i] * rhs[i]
+     */
+    template<template<typename> class Accumulator = NaiveSum, typename SiT1, std::size_t Extent1, typename SiT2,
+             std::size_t Extent2>
+    auto inner_product(std::span<SiT1, Extent1> lhs, std::span<SiT2, Extent2> rhs) {
+        return inner_product<Accumulator>(ThreadPolicy{1}, lhs, rhs);
+    }
+
+#ifdef __cpp_lib_execution
+    // With libstdc++ the parallel policies require linking TBB, the CMake target SIParallel links TBB::tbb if found
+    namespace detail {
+        /**
+         * Checks whether a type is a standard execution policy.
+         */
+        template<typename Policy>
+        constexpr bool isExecutionPolicy = std::is_execution_policy_v<std::remove_cvref_t<Policy>>;
+
+        /**
+         * Accumulate all values using a standard execution policy: the range is split into chunks which are
+         * accumulated sequentially, the accumulators of the chunks are merged in an unspecified order.
+         */
+        template<typename Acc, typename Policy, typename Map>
+        auto accumulate(Policy &&policy, std::size_t size, Map &map) -> Acc {
+            constexpr std::size_t chunkSize = 4096;
+            std::vector<std::size_t> chunks((size + chunkSize - 1) / chunkSize);
+            std::iota(chunks.begin(), chunks.end(), std::size_t{0});
+            return std::transform_reduce(
+                    std::forward<Policy>(policy), chunks.begin(), chunks.end(), Acc{},
+                    [](Acc lhs, const Acc &rhs) {
+                        lhs.merge(rhs);
+                        return lhs;
+                    },
+                    [size, &map](std::size_t chunk) {
+                        auto end = (chunk + 1) * chunkSize;
+                        return accumulate<Acc>(chunk * chunkSize, end < size ? end : size, map);
+                    });
+        }
+    } // namespace detail
+
+    /**
+     * Sum of SI values using a standard execution policy (e.g. std::execution::par).
+     * @tparam Accumulator the summation algorithm, e.g. NaiveSum or NeumaierSum
+     * @tparam Policy the type of the execution policy
+     * @tparam SiT the (possibly const) SI type
+     * @tparam Extent the extent of the span
+     * @param policy the execution policy
+     * @param vals the values
+     * @return the sum
+     */
+    template<template<typename> class Accumulator = NaiveSum, typename Policy, typename SiT, std::size_t Extent,
+             std::enable_if_t<detail::isExecutionPolicy<Policy>, bool> = true>
+    auto reduce(Policy &&policy, std::span<SiT, Extent> vals) -> std::remove_const_t<SiT> {
+        return transform_reduce<Accumulator>(std::forward<Policy>(policy), vals, [](auto val) { return val; });
+    }
+
+    /**
+     * Sum of the transformed SI values using a standard execution policy (e.g. std::execution::par).
+     * @tparam Accumulator the summation algorithm, e.g. NaiveSum or NeumaierSum
+     * @tparam Policy the type of the execution policy
+     * @tparam SiT the (possibly const) SI type
+     * @tparam Extent the extent of the span
+     * @tparam Op the type of the transformation
+     * @param policy the execution policy
+     * @param vals the values
+     * @param op the transformation, needs to return an SI type
+     * @return the sum of op(vals[i])
+     */
+    template<template<typename> class Accumulator = NaiveSum, typename Policy, typename SiT, std::size_t Extent,
+             typename Op, std::enable_if_t<detail::isExecutionPolicy<Policy>, bool> = true>
+    auto transform_reduce(Policy &&policy, std::span<SiT, Extent> vals, Op op) -> detail::ReduceResult<Op, SiT &> {
+        using Res = detail::ReduceResult<Op, SiT &>;
+        static_assert(IsSi<Res>::val, "The transformation needs to return an SI type");
+        auto map = [vals, &op](std::size_t i) { return static_cast<typename Res::type>(op(vals[i])); };
+        auto acc = detail::accumulate<detail::AccumulatorFor<Accumulator, Res>>(std::forward<Policy>(policy),
+                                                                                vals.size(), map);
+        return Res{static_cast<typename Res::type>(acc.result())};
+    }
+
+    /**
+     * Sum of the transformed pairs of SI values using a standard execution policy (e.g. std::execution::par).
+     * @tparam Accumulator the summation algorithm, e.g. NaiveSum or NeumaierSum
+     * @tparam Policy the type of the execution policy
+     * @tparam SiT1 the (possibly const) SI type of the first span
+     * @tparam Extent1 the extent of the first span
+     * @tparam SiT2 the (possibly const) SI type of the second span
+     * @tparam Extent2 the extent of the second span
+     * @tparam Op the type of the transformation
+     * @param policy the execution policy
+     * @param lhs the first values
+     * @param rhs the second values, needs to have the same size as lhs
+     * @param op the transformation, needs to return an SI type
+     * @return the sum of op(lhs[i], rhs[i])
+     */
+    template<template<typename> class Accumulator = NaiveSum, typename Policy, typename SiT1, std::size_t Extent1,
+             typename SiT2, std::size_t Extent2, typename Op,
+             std::enable_if_t<detail::isExecutionPolicy<Policy>, bool> = true>
+    auto transform_reduce(Policy &&policy, std::span<SiT1, Extent1> lhs, std::span<SiT2, Extent2> rhs, Op op)
+            -> detail::ReduceResult<Op, SiT1 &, SiT2 &> {
+        using Res = detail::ReduceResult<Op, SiT1 &, SiT2 &>;
+        static_assert(IsSi<Res>::val, "The transformation needs to return an SI type");
+        assert(lhs.size() == rhs.size() && "Both spans need to have the same size");
+        auto map = [lhs, rhs, &op](std::size_t i) { return static_cast<typename Res::type>(op(lhs[i], rhs[i])); };
+        auto acc = detail::accumulate<detail::AccumulatorFor<Accumulator, Res>>(std::forward<Policy>(policy),
+                                                                                lhs.size(), map);
+        return Res{static_cast<typename Res::type>(acc.result())};
+    }
+
+    /**
+     * Inner product of two spans of SI values using a standard execution policy (e.g. std::execution::par).
+     * @tparam Accumulator the summation algorithm, e.g. NaiveSum or NeumaierSum
+     * @tparam Policy the type of the execution policy
+     * @tparam SiT1 the (possibly const) SI type of the first span
+     * @tparam Extent1 the extent of the first span
+     * @tparam SiT2 the (possibly const) SI type of the second span
+     * @tparam Extent2 the extent of the second span
+     * @param policy the execution policy
+     * @param lhs the first values
+     * @param rhs the second values, needs to have the same size as lhs
+     * @return the sum of lhs[i] * rhs[i]
+     */
+    template<template<typename> class Accumulator = NaiveSum, typename Policy, typename SiT1, std::size_t Extent1,
+             typename SiT2, std::size_t Extent2, std::enable_if_t<detail::isExecutionPolicy<Policy>, bool> = true>
+    auto inner_product(Policy &&policy, std::span<SiT1, Extent1> lhs, std::span<SiT2, Extent2> rhs) {
+        return transform_reduce<Accumulator>(std::forward<Policy>(policy), lhs, rhs,
+                                             [](auto a, auto b) { return a * b; });
+    }
+#endif
+} // namespace si
+
+#endif
@@ -0,0 +1,369 @@
+/**
+ * @file SiArray.hpp
+ * @author paul
+ * @date 17.10.26
+ * @brief Contiguous containers for many values of the same unit, the unit is only stored once in the type.
+ * Arithmetic on the containers is implemented by the expression templates in SiExpression.hpp. Requires C++20.
+ * @ingroup SI
+ */
+#ifndef SI_SIARRAY_HPP
+#define SI_SIARRAY_HPP
+
+#include <cassert>
+#include <cstddef>
+#include <initializer_list>
+#include <span>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "SiExpression.hpp"
+#include "SiImpl.hpp"
+#include "SiSpan.hpp"
+
+namespace si {
+    /**
+     * Non-owning view of contiguous memory of the underlying type, interpreted as values of unit SiT. Views can be
+     * created from existing buffers (for example a std::vector<double>) without copying.
+     * @tparam SiT the SI type of the elements, a const-qualified type results in a read-only view
+     */
+    template<typename SiT>
+    class ArrayView {
+        using SiNoConst = std::remove_const_t<SiT>;
+        static_assert(IsSi<SiNoConst>::val, "ArrayView requires an SI type");
+
+      public:
+        using value_type = SiNoConst;                    ///< SI type of a single element
+        using type = typename SiNoConst::type;           ///< Underlying numerical type
+        using element_type = std::conditional_t<std::is_const_v<SiT>, const type, type>; ///< Stored type
+
+        constexpr ArrayView() noexcept = default;
+
+        /**
+         * Create a view of the given memory.
+         * @param raw the underlying values
+         */
+        constexpr explicit ArrayView(std::span<element_type> raw) noexcept : raw_{raw} {
+        }
+
+        /**
+         * Create a view of a span of SI values.
+         * @param values the SI values
+         */
+        explicit ArrayView(std::span<SiT> values) noexcept : raw_{asRaw(values)} {
+        }
+
+        /**
+         * Create a view of all elements of a vector of the underlying type.
+         * @tparam Alloc the allocator of the vector
+         * @param raw the underlying values
+         */
+        template<typename Alloc>
+        constexpr explicit ArrayView(std::vector<type, Alloc> &raw) noexcept : raw_{raw} {
+        }
+
+        /**
+         * Create a read-only view of all elements of a vector of the underlying type.
+         * @tparam Alloc the allocator of the vector
+         * @param raw the underlying values
+         */
+        template<typename Alloc, typename SiT_ = SiT, std::enable_if_t<std::is_const_v<SiT_>, bool> = true>
+        constexpr explicit ArrayView(const std::vector<type, Alloc> &raw) noexcept : raw_{raw} {
+        }
+
+        /**
+         * A mutable view can always be converted to a read-only view.
+         * @param other the mutable view
+         */
+        template<typename SiT_ = SiT, std::enable_if_t<std::is_const_v<SiT_>, bool> = true>
+        constexpr ArrayView(ArrayView<SiNoConst> other) noexcept /* NOLINT(google-explicit-constructor) */ :
+            raw_{other.raw()} {
+        }
+
+        /**
+         * Number of elements in the view.
+         * @return the number of elements
+         */
+        [[nodiscard]] constexpr auto size() const noexcept -> std::size_t {
+            return raw_.size();
+        }
+
+        /**
+         * Check whether the view contains no elements.
+         * @return true if the size is zero
+         */
+        [[nodiscard]] constexpr auto empty() const noexcept -> bool {
+            return raw_.empty();
+        }
+
+        /**
+         * Pointer to the first underlying value.
+         * @return pointer to the contiguous memory
+         */
+        [[nodiscard]] constexpr auto data() const noexcept -> element_type * {
+            return raw_.data();
+        }
+
+        /**
+         * The underlying values without unit.
+         * @return a span of the underlying memory
+         */
+        [[nodiscard]] constexpr auto raw() const noexcept -> std::span<element_type> {
+            return raw_;
+        }
+
+        /**
+         * Access a single element.
+         * @param i the index
+         * @return a reference to the element, read-only for views of const SI types
+         */
+        auto operator[](std::size_t i) const noexcept -> SiT & {
+            return asSi<SiNoConst>(raw_)[i];
+        }
+
+        /**
+         * Evaluate an expression and write the result to the viewed memory, all operations are performed in a
+         * single loop.
+         * @tparam Expr the type of the expression, the unit needs to match the unit of the view
+         * @param expr the expression, needs to be of the same size as the view
+         */
+        template<typename Expr, std::enable_if_t<IsSiExpression<Expr>::val, bool> = true>
+        void assign(const Expr &expr) const {
+            assert(expr.size() == size() && "Expression is of different size than the view");
+            detail::evaluateInto<value_type>(expr, data());
+        }
+
+      private:
+        std::span<element_type> raw_;
+    };
+
+    /**
+     * Owning container for many values of the same unit, the values are stored as the underlying numerical type in
+     * contiguous memory.
+     * @tparam SiT the SI type of the elements
+     */
+    template<typename SiT>
+    class Array {
+        static_assert(IsSi<SiT>::val, "Array requires an SI type");
+
+      public:
+        using value_type = SiT;              ///< SI type of a single element
+        using type = typename SiT::type;     ///< Underlying numerical type
+        using element_type = type;           ///< Stored type
+
+        Array() = default;
+
+        /**
+         * Create an array of the given size.
+         * @param size the number of elements
+         * @param init the initial value of all elements
+         */
+        explicit Array(std::size_t size, SiT init = SiT{type{}}) : raw_(size, static_cast<type>(init)) {
+        }
+
+        /**
+         * Create an array from a list of SI values.
+         * @param init the initial elements
+         */
+        Array(std::initializer_list<SiT> init) {
+            raw_.reserve(init.size());
+            for (auto val : init) {
+                raw_.push_back(static_cast<type>(val));
+            }
+        }
+
+        /**
+         * Create an array by taking ownership of a vector of the underlying type.
+         * @param raw the underlying values
+         */
+        explicit Array(std::vector<type> raw) noexcept : raw_{std::move(raw)} {
+        }
+
+        /**
+         * Create an array by copying the values of a view.
+         * @tparam SiT_ the (possibly const) SI type of the view
+         * @param view the view to copy
+         */
+        template<typename SiT_, std::enable_if_t<std::is_same_v<std::remove_const_t<SiT_>, SiT>, bool> = true>
+        explicit Array(ArrayView<SiT_> view) : raw_(view.data(), view.data() + view.size()) {
+        }
+
+        /**
+         * Create an array by converting all values of an array with the same unit but another underlying type (e.g.
+         * float storage to double for computations), see convertPrecision.
+         * @tparam SiT_ the SI type of the other array, needs to have the same unit
+         * @param other the array to convert
+         */
+        template<typename SiT_, std::enable_if_t<!std::is_same_v<SiT_, SiT> &&
+                                                         std::is_same_v<typename detail::Rebind<SiT_, type>::type, SiT>,
+                                                 bool> = true>
+        explicit Array(const Array<SiT_> &other) : raw_(other.size()) {
+            convertPrecision(asSi<SiT_>(other.raw()), asSi<SiT>(std::span<type>{raw_}));
+        }
+
+        /**
+         * Create an array by evaluating an expression, all operations are performed in a single loop.
+         * @tparam Expr the type of the expression, the unit needs to match the unit of the array
+         * @param expr the expression
+         */
+        template<typename Expr, std::enable_if_t<IsSiExpression<Expr>::val, bool> = true>
+        Array(const Expr &expr) /* NOLINT(google-explicit-constructor) */ : raw_(expr.size()) {
+            detail::evaluateInto<SiT>(expr, raw_.data());
+        }
+
+        /**
+         * Evaluate an expression and store the result in the array, all operations are performed in a single loop.
+         * The expression may contain the array itself.
+         * @tparam Expr the type of the expression, the unit needs to match the unit of the array
+         * @param expr the expression
+         * @return this array
+         */
+        template<typename Expr, std::enable_if_t<IsSiExpression<Expr>::val, bool> = true>
+        auto operator=(const Expr &expr) -> Array & {
+            if (expr.size() == raw_.size()) {
+                detail::evaluateInto<SiT>(expr, raw_.data());
+            } else {
+                std::vector<type> res(expr.size());
+                detail::evaluateInto<SiT>(expr, res.data());
+                raw_ = std::move(res);
+            }
+            return *this;
+        }
+
+        /**
+         * Number of elements in the array.
+         * @return the number of elements
+         */
+        [[nodiscard]] auto size() const noexcept -> std::size_t {
+            return raw_.size();
+        }
+
+        /**
+         * Check whether the array contains no elements.
+         * @return true if the size is zero
+         */
+        [[nodiscard]] auto empty() const noexcept -> bool {
+            return raw_.empty();
+        }
+
+        /**
+         * Pointer to the first underlying value.
+         * @return pointer to the contiguous memory
+         */
+        [[nodiscard]] auto data() noexcept -> type * {
+            return raw_.data();
+        }
+
+        /**
+         * Pointer to the first underlying value.
+         * @return pointer to the contiguous memory
+         */
+        [[nodiscard]] auto data() const noexcept -> const type * {
+            return raw_.data();
+        }
+
+        /**
+         * The underlying values without unit.
+         * @return a span of the underlying memory
+         */
+        [[nodiscard]] auto raw() noexcept -> std::span<type> {
+            return raw_;
+        }
+
+        /**
+         * The underlying values without unit.
+         * @return a span of the underlying memory
+         */
+        [[nodiscard]] auto raw() const noexcept -> std::span<const type> {
+            return raw_;
+        }
+
+        /**
+         * Mutable view of all elements.
+         * @return a view of the array
+         */
+        [[nodiscard]] auto view() noexcept -> ArrayView<SiT> {
+            return ArrayView<SiT>{raw()};
+        }
+
+        /**
+         * Read-only view of all elements.
+         * @return a view of the array
+         */
+        [[nodiscard]] auto view() const noexcept -> ArrayView<const SiT> {
+            return ArrayView<const SiT>{raw()};
+        }
+
+        /**
+         * Read a single element.
+         * @param i the index
+         * @return a reference to the element
+         */
+        auto operator[](std::size_t i) const noexcept -> const SiT & {
+            return asSi<SiT>(raw())[i];
+        }
+
+        /**
+         * Access a single element.
+         * @param i the index
+         * @return a reference to the element
+         */
+        auto operator[](std::size_t i) noexcept -> SiT & {
+            return asSi<SiT>(raw())[i];
+        }
+
+        /**
+         * Append an element at the end of the array.
+         * @param val the element to add
+         */
+        void push_back(SiT val) { // NOLINT(readability-identifier-naming) consistent with the STL
+            raw_.push_back(static_cast<type>(val));
+        }
+
+        /**
+         * Change the number of elements.
+         * @param size the new size
+         * @param init the value of newly inserted elements
+         */
+        void resize(std::size_t size, SiT init = SiT{type{}}) {
+            raw_.resize(size, static_cast<type>(init));
+        }
+
+        /**
+         * Reserve memory for the given number of elements.
+         * @param size the number of elements
+         */
+        void reserve(std::size_t size) {
+            raw_.reserve(size);
+        }
+
+      private:
+        std::vector<type> raw_;
+    };
+
+    /**
+     * Specialization of type trait to check whether a type is an array of SI values for views.
+     * @tparam SiT the SI type of the elements
+     */
+    template<typename SiT>
+    struct IsSiArray<ArrayView<SiT>> {
+        /**
+         * Type is an array of SI values.
+         */
+        static constexpr auto val = true;
+    };
+
+    /**
+     * Specialization of type trait to check whether a type is an array of SI values for arrays.
+     * @tparam SiT the SI type of the elements
+     */
+    template<typename SiT>
+    struct IsSiArray<Array<SiT>> {
+        /**
+         * Type is an array of SI values.
+         */
+        static constexpr auto val = true;
+    };
+} // namespace si
+
+#endif
@@ -12,14 +12,21 @@
 #include "SiGenerator.hpp"
 #include "SiImpl.hpp"
 
-SI_CREATE_UNIT(Scalar, scalar, 0, 0, 0, 0, 0, 0, 0)
-SI_CREATE_UNIT(Meter, meter, 1, 0, 0, 0, 0, 0, 0)
-SI_CREATE_UNIT(Kilogram, kilogram, 0, 1, 0, 0, 0, 0, 0)
-SI_CREATE_UNIT(Second, second, 0, 0, 1, 0, 0, 0, 0)
-SI_CREATE_UNIT(Ampere, ampere, 0, 0, 0, 1, 0, 0, 0)
-SI_CREATE_UNIT(Kelvin, kelvin, 0, 0, 0, 0, 1, 0, 0)
-SI_CREATE_UNIT(Mole, mole, 0, 0, 0, 0, 0, 1, 0)
-SI_CREATE_UNIT(Candela, candela, 0, 0, 0, 0, 0, 0, 1)
+/**
+ * List of the base units (and the scalar) in the format X(Name, name, m, kg, s, A, K, Mol, CD), the units are created
+ * by passing SI_CREATE_UNIT, the parser uses the list for the names of the literals.
+ */
+#define SI_BASE_UNITS(X) /* NOLINT(cppcoreguidelines-macro-usage) */                                                   \
+    X(Scalar, scalar, 0, 0, 0, 0, 0, 0, 0)                                                                             \
+    X(Meter, meter, 1, 0, 0, 0, 0, 0, 0)                                                                               \
+    X(Kilogram, kilogram, 0, 1, 0, 0, 0, 0, 0)                                                                         \
+    X(Second, second, 0, 0, 1, 0, 0, 0, 0)                                                                             \
+    X(Ampere, ampere, 0, 0, 0, 1, 0, 0, 0)                                                                             \
+    X(Kelvin, kelvin, 0, 0, 0, 0, 1, 0, 0)                                                                             \
+    X(Mole, mole, 0, 0, 0, 0, 0, 1, 0)                                                                                 \
+    X(Candela, candela, 0, 0, 0, 0, 0, 0, 1)
+
+SI_BASE_UNITS(SI_CREATE_UNIT)
 
 
 namespace si {
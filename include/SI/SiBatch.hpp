@@ -0,0 +1,458 @@
+/**
+ * @file SiBatch.hpp
+ * @author paul
+ * @date 17.10.26
+ * @brief SIMD type for a fixed number of values (lanes) of the same unit. Requires C++20.
+ * @ingroup SI
+ */
+#ifndef SI_SIBATCH_HPP
+#define SI_SIBATCH_HPP
+
+#include <array>
+#include <bit>
+#include <cassert>
+#include <cstddef>
+#include <span>
+#include <utility>
+
+#include "SiImpl.hpp"
+#include "SiSpan.hpp"
+
+#if !defined(SI_BATCH_NO_STD_SIMD) && __has_include(<experimental/simd>)
+    #include <experimental/simd>
+    #define SI_BATCH_HAS_STD_SIMD 1 ///< Batch is backed by std::experimental::simd
+#else
+    #define SI_BATCH_HAS_STD_SIMD 0 ///< Batch is backed by plain arrays which are vectorized by the compiler
+#endif
+
+namespace si {
+    namespace detail {
+#if SI_BATCH_HAS_STD_SIMD
+        /**
+         * Storage for the lanes of a batch.
+         */
+        template<typename T, std::size_t N>
+        using Lanes = std::experimental::fixed_size_simd<T, N>;
+
+        /**
+         * Number of lanes that fit into a native SIMD register for the given type.
+         */
+        template<typename T>
+        constexpr std::size_t nativeLanes = std::experimental::native_simd<T>::size();
+
+        /**
+         * Sum of all lanes.
+         */
+        template<typename Simd>
+        constexpr auto reduceLanes(const Simd &lanes) -> typename Simd::value_type {
+            return std::experimental::reduce(lanes);
+        }
+
+        /**
+         * Minimum of all lanes.
+         */
+        template<typename Simd>
+        constexpr auto minLanes(const Simd &lanes) -> typename Simd::value_type {
+            return std::experimental::hmin(lanes);
+        }
+
+        /**
+         * Maximum of all lanes.
+         */
+        template<typename Simd>
+        constexpr auto maxLanes(const Simd &lanes) -> typename Simd::value_type {
+            return std::experimental::hmax(lanes);
+        }
+
+        /**
+         * Load lanes from unaligned memory.
+         */
+        template<typename T, std::size_t N>
+        constexpr auto loadLanes(const T *src) -> Lanes<T, N> {
+            return Lanes<T, N>{src, std::experimental::element_aligned};
+        }
+
+        /**
+         * Store lanes to unaligned memory.
+         */
+        template<typename T, std::size_t N>
+        constexpr void storeLanes(const Lanes<T, N> &lanes, T *dst) {
+            lanes.copy_to(dst, std::experimental::element_aligned);
+        }
+#else
+        /**
+         * Storage for the lanes of a batch, all operations are simple loops over an aligned array which are
+         * vectorized by the compiler.
+         */
+        template<typename T, std::size_t N>
+        class Lanes {
+          public:
+            constexpr Lanes() noexcept = default;
+
+            /**
+             * Broadcast a value to all lanes.
+             * @param val the value for all lanes
+             */
+            constexpr explicit Lanes(T val) noexcept {
+                for (auto &lane : data) {
+                    lane = val;
+                }
+            }
+
+            /**
+             * Create the lanes from a generator function which is called with the index of every lane.
+             * @tparam Gen the type of the generator
+             * @param gen the generator
+             */
+            template<typename Gen, typename = decltype(std::declval<Gen>()(std::size_t{}))>
+            constexpr explicit Lanes(Gen &&gen) {
+                for (std::size_t i = 0; i < N; ++i) {
+                    data[i] = gen(i);
+                }
+            }
+
+            /**
+             * Read a single lane.
+             * @param i the index of the lane
+             * @return the value of the lane
+             */
+            constexpr auto operator[](std::size_t i) const -> T {
+                return data[i];
+            }
+
+            /**
+             * Lane-wise unary minus.
+             * @return the negated lanes
+             */
+            constexpr auto operator-() const -> Lanes {
+                return apply([](T a) { return -a; });
+            }
+
+            /**
+             * Lane-wise sum.
+             */
+            friend constexpr auto operator+(const Lanes &lhs, const Lanes &rhs) -> Lanes {
+                return lhs.combine(rhs, [](T a, T b) { return a + b; });
+            }
+
+            /**
+             * Lane-wise difference.
+             */
+            friend constexpr auto operator-(const Lanes &lhs, const Lanes &rhs) -> Lanes {
+                return lhs.combine(rhs, [](T a, T b) { return a - b; });
+            }
+
+            /**
+             * Lane-wise product.
+             */
+            friend constexpr auto operator*(const Lanes &lhs, const Lanes &rhs) -> Lanes {
+                return lhs.combine(rhs, [](T a, T b) { return a * b; });
+            }
+
+            /**
+             * Lane-wise quotient.
+             */
+            friend constexpr auto operator/(const Lanes &lhs, const Lanes &rhs) -> Lanes {
+                return lhs.combine(rhs, [](T a, T b) { return a / b; });
+            }
+
+            /**
+             * Scale all lanes, the scalar is not broadcast to a temporary which the compiler fails to eliminate.
+             */
+            friend constexpr auto operator*(const Lanes &lhs, T rhs) -> Lanes {
+                return lhs.apply([rhs](T a) { return a * rhs; });
+            }
+
+            /**
+             * Divide all lanes by a scalar.
+             */
+            friend constexpr auto operator/(const Lanes &lhs, T rhs) -> Lanes {
+                return lhs.apply([rhs](T a) { return a / rhs; });
+            }
+
+            /// The lanes, aligned like a vector register if their size is a power of two
+            alignas(std::has_single_bit(N * sizeof(T)) && N * sizeof(T) <= 64 ? N * sizeof(T) : alignof(T))
+                    std::array<T, N> data{};
+
+          private:
+            template<typename Op>
+            constexpr auto apply(Op op) const -> Lanes {
+                Lanes res{*this};
+                for (std::size_t i = 0; i < N; ++i) {
+                    res.data[i] = op(res.data[i]);
+                }
+                return res;
+            }
+
+            template<typename Op>
+            constexpr auto combine(const Lanes &rhs, Op op) const -> Lanes {
+                Lanes res{*this};
+                for (std::size_t i = 0; i < N; ++i) {
+                    res.data[i] = op(res.data[i], rhs.data[i]);
+                }
+                return res;
+            }
+        };
+
+        /**
+         * Number of lanes that fit into a 128 bit register for the given type.
+         */
+        template<typename T>
+        constexpr std::size_t nativeLanes = sizeof(T) < 16 ? 16 / sizeof(T) : 1;
+
+        /**
+         * Sum of all lanes.
+         */
+        template<typename T, std::size_t N>
+        constexpr auto reduceLanes(const Lanes<T, N> &lanes) -> T {
+            T res = lanes.data[0];
+            for (std::size_t i = 1; i < N; ++i) {
+                res += lanes.data[i];
+            }
+            return res;
+        }
+
+        /**
+         * Minimum of all lanes.
+         */
+        template<typename T, std::size_t N>
+        constexpr auto minLanes(const Lanes<T, N> &lanes) -> T {
+            T res = lanes.data[0];
+            for (std::size_t i = 1; i < N; ++i) {
+                res = lanes.data[i] < res ? lanes.data[i] : res;
+            }
+            return res;
+        }
+
+        /**
+         * Maximum of all lanes.
+         */
+        template<typename T, std::size_t N>
+        constexpr auto maxLanes(const Lanes<T, N> &lanes) -> T {
+            T res = lanes.data[0];
+            for (std::size_t i = 1; i < N; ++i) {
+                res = lanes.data[i] > res ? lanes.data[i] : res;
+            }
+            return res;
+        }
+
+        /**
+         * Load lanes from unaligned memory.
+         */
+        template<typename T, std::size_t N>
+        constexpr auto loadLanes(const T *src) -> Lanes<T, N> {
+            Lanes<T, N> res;
+            for (std::size_t i = 0; i < N; ++i) {
+                res.data[i] = src[i];
+            }
+            return res;
+        }
+
+        /**
+         * Store lanes to unaligned memory.
+         */
+        template<typename T, std::size_t N>
+        constexpr void storeLanes(const Lanes<T, N> &lanes, T *dst) {
+            for (std::size_t i = 0; i < N; ++i) {
+                dst[i] = lanes.data[i];
+            }
+        }
+#endif
+    } // namespace detail
+
+    /**
+     * SIMD type for N values of the same unit. All operations are performed on all lanes at once, the resulting
+     * unit is calculated by the operators of Si.
+     * @tparam SiT the SI type of a single lane
+     * @tparam N the number of lanes, by default the number of values that fit into a native SIMD register
+     */
+    template<typename SiT, std::size_t N = detail::nativeLanes<typename SiT::type>>
+    class Batch {
+        static_assert(IsSi<SiT>::val, "Batch requires an SI type");
+        static_assert(N > 0, "Batch requires at least one lane");
+
+      public:
+        using value_type = SiT;                   ///< SI type of a single lane
+        using type = typename SiT::type;          ///< Underlying numerical type
+        using lanes_type = detail::Lanes<type, N>; ///< Type used for storing the underlying values
+
+        static constexpr std::size_t size = N; ///< Number of lanes
+
+        constexpr Batch() noexcept = default;
+
+        /**
+         * Broadcast a single value to all lanes.
+         * @param val the value for all lanes
+         */
+        constexpr explicit Batch(SiT val) noexcept : lanes{static_cast<type>(val)} {
+        }
+
+        /**
+         * Create a batch from the underlying values.
+         * @param lanes the underlying values
+         */
+        constexpr explicit Batch(const lanes_type &lanes) noexcept : lanes{lanes} {
+        }
+
+        /**
+         * Load N values from a span of SI values.
+         * @param src the values, needs to contain at least N values
+         * @return a batch of the first N values
+         */
+        static constexpr auto load(std::span<const SiT> src) -> Batch {
+            assert(src.size() >= N && "Not enough values to load a batch");
+            return loadRaw(asRaw(src).data());
+        }
+
+        /**
+         * Load N values from memory of the underlying type (for example the data of an Array).
+         * @param src pointer to at least N values
+         * @return a batch of the first N values
+         */
+        static constexpr auto loadRaw(const type *src) -> Batch {
+            return Batch{detail::loadLanes<type, N>(src)};
+        }
+
+        /**
+         * Store all lanes to a span of SI values.
+         * @param dst the destination, needs to provide space for at least N values
+         */
+        constexpr void store(std::span<SiT> dst) const {
+            assert(dst.size() >= N && "Not enough space to store a batch");
+            storeRaw(asRaw(dst).data());
+        }
+
+        /**
+         * Store all lanes to memory of the underlying type (for example the data of an Array).
+         * @param dst pointer to space for at least N values
+         */
+        constexpr void storeRaw(type *dst) const {
+            detail::storeLanes<type, N>(lanes, dst);
+        }
+
+        /**
+         * Read a single lane.
+         * @param i the index of the lane
+         * @return the value of the lane
+         */
+        constexpr auto operator[](std::size_t i) const -> SiT {
+            return SiT{lanes[i]};
+        }
+
+        /**
+         * The underlying values.
+         * @return the underlying values without unit
+         */
+        constexpr auto raw() const -> const lanes_type & {
+            return lanes;
+        }
+
+        /**
+         * Horizontal sum of all lanes.
+         * @return the sum with the unit of the lanes
+         */
+        constexpr auto sum() const -> SiT {
+            return SiT{detail::reduceLanes(lanes)};
+        }
+
+        /**
+         * Horizontal minimum of all lanes.
+         * @return the smallest lane
+         */
+        constexpr auto min() const -> SiT {
+            return SiT{detail::minLanes(lanes)};
+        }
+
+        /**
+         * Horizontal maximum of all lanes.
+         * @return the largest lane
+         */
+        constexpr auto max() const -> SiT {
+            return SiT{detail::maxLanes(lanes)};
+        }
+
+        /**
+         * Lane-wise sum of batches of the same unit.
+         * @param rhs the other batch
+         * @return the sum
+         */
+        constexpr auto operator+(const Batch &rhs) const -> Batch {
+            return Batch{lanes + rhs.lanes};
+        }
+
+        /**
+         * Lane-wise difference of batches of the same unit.
+         * @param rhs the other batch
+         * @return the difference
+         */
+        constexpr auto operator-(const Batch &rhs) const -> Batch {
+            return Batch{lanes - rhs.lanes};
+        }
+
+        /**
+         * Unary minus, apply unary minus to all lanes and keep the unit.
+         * @return the negative of the batch
+         */
+        constexpr auto operator-() const -> Batch {
+            return Batch{-lanes};
+        }
+
+        /**
+         * Scale all lanes with a unitless factor.
+         * @param rhs the factor
+         * @return the scaled batch
+         */
+        constexpr auto operator*(type rhs) const -> Batch {
+            return Batch{lanes * rhs};
+        }
+
+        /**
+         * Scale all lanes with 1/divisor.
+         * @param rhs the divisor
+         * @return the scaled batch
+         */
+        constexpr auto operator/(type rhs) const -> Batch {
+            return Batch{lanes / rhs};
+        }
+
+        /**
+         * Lane-wise product of two batches, the unit is the product of the units.
+         * @tparam SiT_ the SI type of the other batch
+         * @param rhs the other batch
+         * @return the product
+         */
+        template<typename SiT_>
+        constexpr auto operator*(const Batch<SiT_, N> &rhs) const {
+            using Res = decltype(std::declval<SiT>() * std::declval<SiT_>());
+            return Batch<Res, N>{lanes * rhs.raw()};
+        }
+
+        /**
+         * Lane-wise quotient of two batches, the unit is the quotient of the units.
+         * @tparam SiT_ the SI type of the other batch
+         * @param rhs the divisor
+         * @return the quotient
+         */
+        template<typename SiT_>
+        constexpr auto operator/(const Batch<SiT_, N> &rhs) const {
+            using Res = decltype(std::declval<SiT>() / std::declval<SiT_>());
+            return Batch<Res, N>{lanes / rhs.raw()};
+        }
+
+      private:
+        lanes_type lanes;
+    };
+
+    /**
+     * Scale all lanes with a unitless factor.
+     * @param lhs the factor
+     * @param rhs the batch
+     * @return the scaled batch
+     */
+    template<typename SiT, std::size_t N>
+    constexpr auto operator*(typename SiT::type lhs, const Batch<SiT, N> &rhs) -> Batch<SiT, N> {
+        return rhs * lhs;
+    }
+} // namespace si
+
+#endif
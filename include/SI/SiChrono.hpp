@@ -0,0 +1,110 @@
+/**
+ * @file SiChrono.hpp
+ * @author paul
+ * @date 17.10.26
+ * @brief Conversion between Second/Hertz and std::chrono::duration, the period is folded at compile time.
+ * @ingroup SI
+ */
+#ifndef SI_SICHRONO_HPP
+#define SI_SICHRONO_HPP
+
+#include <cassert>
+#include <chrono>
+#include <cstdint>
+#include <ratio>
+#include <type_traits>
+
+#include "SiBase.hpp"
+#include "SiExtended.hpp"
+#include "SiImpl.hpp"
+#include "SiScaled.hpp"
+
+namespace si {
+    /**
+     * Convert a duration to a scaled second with the same representation and period, this is exact and does not
+     * require any computation.
+     * @tparam Rep the representation of the duration
+     * @tparam Period the period of the duration
+     * @param duration the duration
+     * @return the duration as scaled second
+     */
+    template<typename Rep, typename Period>
+    constexpr auto toScaled(std::chrono::duration<Rep, Period> duration) noexcept -> Scaled<Second<Rep>, Period> {
+        return Scaled<Second<Rep>, Period>{duration.count()};
+    }
+
+    /**
+     * Convert a scaled second to a duration with the same representation and period, this is exact and does not
+     * require any computation.
+     * @tparam Rep the underlying type of the scaled second
+     * @tparam Period the scale of the scaled second
+     * @param scaled the scaled second
+     * @return the value as duration
+     */
+    template<typename Rep, typename Period>
+    constexpr auto toDuration(Scaled<Second<Rep>, Period> scaled) noexcept -> std::chrono::duration<Rep, Period> {
+        return std::chrono::duration<Rep, Period>{scaled.count()};
+    }
+
+    /**
+     * Convert a duration to seconds, the period is folded into a single constant factor.
+     * @tparam T the underlying type of the result
+     * @tparam Rep the representation of the duration
+     * @tparam Period the period of the duration
+     * @param duration the duration
+     * @return the duration in seconds, truncated if T is an integer type
+     */
+    template<typename T = default_type, typename Rep, typename Period>
+    constexpr auto toSecond(std::chrono::duration<Rep, Period> duration) noexcept -> Second<T> {
+        return Second<T>{detail::rescale<Period, std::ratio<1>, T>(duration.count())};
+    }
+
+    /**
+     * Convert seconds to a duration, the period is folded into a single constant factor.
+     * @tparam Duration the type of the result, a std::chrono::duration
+     * @tparam T the underlying type of the seconds
+     * @param second the value in seconds
+     * @return the value as duration, truncated if the representation of Duration is an integer type
+     */
+    template<typename Duration, typename T>
+    constexpr auto toDuration(Second<T> second) noexcept -> Duration {
+        return Duration{detail::rescale<std::ratio<1>, typename Duration::period, typename Duration::rep>(
+                static_cast<T>(second))};
+    }
+
+    /**
+     * Frequency corresponding to a period given as duration.
+     * @tparam T the underlying type of the result
+     * @tparam Rep the representation of the duration
+     * @tparam Period the period of the duration
+     * @param period the period, must not be zero (this would be a division by zero for integer types)
+     * @return the frequency, i.e. 1 / period
+     */
+    template<typename T = default_type, typename Rep, typename Period>
+    constexpr auto toHertz(std::chrono::duration<Rep, Period> period) noexcept -> Hertz<T> {
+        assert(period.count() != Rep{0} && "The period must not be zero");
+        // 1 / (count * num / den) = den / (count * num)
+        return Hertz<T>{static_cast<T>(Period::den) / (static_cast<T>(period.count()) * static_cast<T>(Period::num))};
+    }
+
+    /**
+     * Period corresponding to a frequency as duration.
+     * @tparam Duration the type of the result, a std::chrono::duration
+     * @tparam T the underlying type of the frequency
+     * @param frequency the frequency, must not be zero (the period would be infinite which can not be represented
+     *      by an integer representation, for integer types this would be a division by zero)
+     * @return the period, i.e. 1 / frequency, truncated if the representation of Duration is an integer type
+     */
+    template<typename Duration, typename T>
+    constexpr auto toPeriod(Hertz<T> frequency) noexcept -> Duration {
+        assert(static_cast<T>(frequency) != T{0} && "The frequency must not be zero");
+        // (1 / f) / (num / den) = den / (f * num)
+        using Period = typename Duration::period;
+        using Rep = typename Duration::rep;
+        using Common = std::common_type_t<T, std::intmax_t>;
+        return Duration{static_cast<Rep>(static_cast<Common>(Period::den) /
+                                         (static_cast<Common>(frequency) * static_cast<Common>(Period::num)))};
+    }
+} // namespace si
+
+#endif
@@ -0,0 +1,424 @@
+/**
+ * @file SiDynamic.hpp
+ * @author paul
+ * @date 17.10.26
+ * @brief Values whose unit is only known at runtime, together with conversion to and from the static SI types.
+ * @ingroup SI
+ */
+#ifndef SI_SIDYNAMIC_HPP
+#define SI_SIDYNAMIC_HPP
+
+#include <array>
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+#include "SiImpl.hpp"
+
+namespace si {
+    /**
+     * Runtime representation of a unit, the seven exponents are packed into a single 64 bit word (one signed byte
+     * per exponent, in the order of the template arguments of Si). Comparing two dimensions is a single integer
+     * comparison, multiplication and division are implemented as lane-wise addition and subtraction of the packed
+     * word. Exponents need to be in the range [-128, 127], this is checked at compile time for static SI types and
+     * by assertions for all other operations.
+     */
+    class Dimension {
+        static constexpr std::uint64_t highBits = 0x0080808080808080ULL; ///< Most significant bit of every lane
+
+      public:
+        /**
+         * Create the dimension of a unitless value.
+         */
+        constexpr Dimension() noexcept = default;
+
+        /**
+         * Create a dimension from the exponents.
+         * @param m the meter exponent
+         * @param kg the kilogram exponent
+         * @param s the second exponent
+         * @param A the Ampere exponent
+         * @param K the Kelvin exponent
+         * @param MOL the Mol exponent
+         * @param CD the Candela exponent
+         */
+        constexpr Dimension(int m, int kg, int s, int A, int K, int MOL, int CD) noexcept :
+            word{lane(m, 0) | lane(kg, 1) | lane(s, 2) | lane(A, 3) | lane(K, 4) | lane(MOL, 5) | lane(CD, 6)} {
+            assert(inRange(m) && inRange(kg) && inRange(s) && inRange(A) && inRange(K) && inRange(MOL) &&
+                   inRange(CD) && "Exponent out of range");
+        }
+
+        /**
+         * Get the dimension of a static SI type.
+         * @tparam SiT the SI type
+         * @return the dimension of SiT
+         */
+        template<typename SiT>
+        static constexpr auto of() noexcept -> Dimension {
+            static_assert(IsSi<SiT>::val, "Dimension::of requires an SI type");
+            static_assert(inRange(SiT::meter) && inRange(SiT::kilogram) && inRange(SiT::second) &&
+                                  inRange(SiT::ampere) && inRange(SiT::kelvin) && inRange(SiT::mole) &&
+                                  inRange(SiT::candela),
+                          "Exponent out of range for Dimension");
+            return Dimension{SiT::meter,  SiT::kilogram, SiT::second, SiT::ampere,
+                             SiT::kelvin, SiT::mole,     SiT::candela};
+        }
+
+        /**
+         * Create a dimension from its packed representation.
+         * @param packed the packed exponents as returned by packed()
+         * @return the dimension
+         */
+        static constexpr auto fromPacked(std::uint64_t packed) noexcept -> Dimension {
+            Dimension res;
+            res.word = packed & laneMask;
+            return res;
+        }
+
+        /**
+         * Packed representation of all exponents.
+         * @return one signed byte per exponent, the most significant byte is always zero
+         */
+        [[nodiscard]] constexpr auto packed() const noexcept -> std::uint64_t {
+            return word;
+        }
+
+        /**
+         * Get a single exponent.
+         * @param i the index of the base unit in the order of the template arguments of Si
+         * @return the exponent
+         */
+        [[nodiscard]] constexpr auto exponent(std::size_t i) const noexcept -> int {
+            return static_cast<std::int8_t>(static_cast<std::uint8_t>(word >> (8 * i)));
+        }
+
+        /**
+         * Checks whether the dimension is unitless.
+         * @return true if all exponents are zero
+         */
+        [[nodiscard]] constexpr auto isScalar() const noexcept -> bool {
+            return word == 0;
+        }
+
+        /**
+         * Dimension of a product, i.e. the sum of all exponents.
+         * @param rhs the other dimension
+         * @return the dimension of the product
+         */
+        constexpr auto operator*(Dimension rhs) const noexcept -> Dimension {
+            auto sum = ((word & ~highBits) + (rhs.word & ~highBits)) ^ ((word ^ rhs.word) & highBits);
+            // Signed overflow in a lane: both operands have the same sign which differs from the sign of the result
+            assert(((word ^ sum) & (rhs.word ^ sum) & highBits) == 0 && "Exponent out of range");
+            return fromPacked(sum);
+        }
+
+        /**
+         * Dimension of a quotient, i.e. the difference of all exponents.
+         * @param rhs the dimension of the divisor
+         * @return the dimension of the quotient
+         */
+        constexpr auto operator/(Dimension rhs) const noexcept -> Dimension {
+            auto diff = ((word | highBits) - (rhs.word & ~highBits)) ^ ((word ^ ~rhs.word) & highBits);
+            // Signed overflow in a lane: the operands have different signs and the sign of the result is wrong
+            assert(((word ^ rhs.word) & (word ^ diff) & highBits) == 0 && "Exponent out of range");
+            return fromPacked(diff);
+        }
+
+        /**
+         * Equality of dimensions, i.e. all exponents are equal.
+         * @param rhs the other dimension
+         * @return true if the dimensions are equal
+         */
+        constexpr auto operator==(Dimension rhs) const noexcept -> bool {
+            return word == rhs.word;
+        }
+
+        /**
+         * Non-Equality of dimensions.
+         * @param rhs the other dimension
+         * @return true if at least one exponent differs
+         */
+        constexpr auto operator!=(Dimension rhs) const noexcept -> bool {
+            return word != rhs.word;
+        }
+
+      private:
+        static constexpr std::uint64_t laneMask = 0x00FFFFFFFFFFFFFFULL; ///< All seven lanes
+
+        static constexpr auto inRange(int exp) noexcept -> bool {
+            return exp >= -128 && exp <= 127;
+        }
+
+        static constexpr auto lane(int exp, int i) noexcept -> std::uint64_t {
+            return static_cast<std::uint64_t>(static_cast<std::uint8_t>(exp)) << (8 * i);
+        }
+
+        std::uint64_t word = 0;
+    };
+
+    /**
+     * Value with a unit that is only known at runtime. Operations that require identical units (addition,
+     * subtraction, comparison) throw std::invalid_argument if the units differ.
+     * @tparam T the underlying numerical type
+     */
+    template<typename T = default_type>
+    class DynamicSi {
+      public:
+        using type = T; ///< Underlying numerical type
+
+        constexpr DynamicSi() noexcept = default;
+
+        /**
+         * Create a value from the underlying value and the dimension.
+         * @param val the numerical value
+         * @param dim the unit
+         */
+        constexpr DynamicSi(T val, Dimension dim) noexcept : val{val}, dim{dim} {
+        }
+
+        /**
+         * Create a value from a static SI type, the conversion is always possible.
+         * @param si the SI value
+         */
+        template<int m, int kg, int s, int A, int K, int MOL, int CD>
+        constexpr DynamicSi(Si<m, kg, s, A, K, MOL, CD, T> si) noexcept /* NOLINT(google-explicit-constructor) */ :
+            val{static_cast<T>(si)}, dim{Dimension::of<Si<m, kg, s, A, K, MOL, CD, T>>()} {
+        }
+
+        /**
+         * The numerical value.
+         * @return the value without unit
+         */
+        [[nodiscard]] constexpr auto value() const noexcept -> T {
+            return val;
+        }
+
+        /**
+         * The unit of the value.
+         * @return the dimension
+         */
+        [[nodiscard]] constexpr auto dimension() const noexcept -> Dimension {
+            return dim;
+        }
+
+        /**
+         * Checks whether the value is of the unit of a static SI type.
+         * @tparam SiT the SI type
+         * @return true if the conversion to SiT is possible
+         */
+        template<typename SiT>
+        [[nodiscard]] constexpr auto is() const noexcept -> bool {
+            return dim == Dimension::of<SiT>();
+        }
+
+        /**
+         * Checked conversion to a static SI type.
+         * @tparam SiT the SI type
+         * @return the value as SiT if the units match, otherwise std::nullopt
+         */
+        template<typename SiT>
+        [[nodiscard]] constexpr auto as() const noexcept -> std::optional<SiT> {
+            static_assert(std::is_same_v<typename SiT::type, T>, "Underlying types do not match");
+            if (is<SiT>()) {
+                return SiT{val};
+            }
+            return std::nullopt;
+        }
+
+        /**
+         * Add a value of the same unit.
+         * @param rhs the other value
+         * @return the sum
+         * @throws std::invalid_argument if the units differ
+         */
+        constexpr auto operator+(DynamicSi rhs) const -> DynamicSi {
+            checkDimension(rhs);
+            return DynamicSi{val + rhs.val, dim};
+        }
+
+        /**
+         * Subtract a value of the same unit.
+         * @param rhs the other value
+         * @return the difference
+         * @throws std::invalid_argument if the units differ
+         */
+        constexpr auto operator-(DynamicSi rhs) const -> DynamicSi {
+            checkDimension(rhs);
+            return DynamicSi{val - rhs.val, dim};
+        }
+
+        /**
+         * Unary minus, apply unary minus to value and keep unit.
+         * @return the negative of the value
+         */
+        constexpr auto operator-() const noexcept -> DynamicSi {
+            return DynamicSi{-val, dim};
+        }
+
+        /**
+         * Multiply two values, the unit is the product of the units.
+         * @param rhs the other value
+         * @return the product
+         */
+        constexpr auto operator*(DynamicSi rhs) const noexcept -> DynamicSi {
+            return DynamicSi{val * rhs.val, dim * rhs.dim};
+        }
+
+        /**
+         * Divide two values, the unit is the quotient of the units.
+         * @param rhs the divisor
+         * @return the quotient
+         */
+        constexpr auto operator/(DynamicSi rhs) const noexcept -> DynamicSi {
+            return DynamicSi{val / rhs.val, dim / rhs.dim};
+        }
+
+        /**
+         * Equality operator, values of different units are never equal.
+         * @param rhs the other value
+         * @return true if unit and value are equal
+         */
+        constexpr auto operator==(DynamicSi rhs) const noexcept -> bool {
+            return dim == rhs.dim && val == rhs.val;
+        }
+
+        /**
+         * Non-Equality operator.
+         * @param rhs the other value
+         * @return true if unit or value differ
+         */
+        constexpr auto operator!=(DynamicSi rhs) const noexcept -> bool {
+            return !(*this == rhs);
+        }
+
+        /**
+         * Less than operator for values of the same unit.
+         * @param rhs the other value
+         * @return true if this is less than rhs
+         * @throws std::invalid_argument if the units differ
+         */
+        constexpr auto operator<(DynamicSi rhs) const -> bool {
+            checkDimension(rhs);
+            return val < rhs.val;
+        }
+
+        /**
+         * Greater than operator for values of the same unit.
+         * @param rhs the other value
+         * @return true if this is greater than rhs
+         * @throws std::invalid_argument if the units differ
+         */
+        constexpr auto operator>(DynamicSi rhs) const -> bool {
+            return rhs < *this;
+        }
+
+      private:
+        constexpr void checkDimension(DynamicSi rhs) const {
+            if (dim != rhs.dim) {
+                throw std::invalid_argument{"Units of DynamicSi values do not match"};
+            }
+        }
+
+        T val{};
+        Dimension dim;
+    };
+
+    namespace detail {
+        /**
+         * Table for dispatching a dynamic value to a function for the matching static type. The dimensions of all
+         * types are sorted at compile time, so a lookup is a binary search on the packed dimensions followed by an
+         * indirect call.
+         * @tparam F the type of the function
+         * @tparam T the underlying type
+         * @tparam SiTs all static SI types
+         */
+        template<typename F, typename T, typename... SiTs>
+        struct DispatchTable {
+            static constexpr std::size_t size = sizeof...(SiTs); ///< Number of types
+
+            using Fn = void (*)(T, F &); ///< Function calling F with one specific type
+
+            /**
+             * Call the function with a specific static type.
+             */
+            template<typename SiT>
+            static void call(T val, F &f) {
+                f(SiT{val});
+            }
+
+            /**
+             * Sort the packed dimensions of all types.
+             * @return pairs of packed dimensions and the index of the type
+             */
+            static constexpr auto makeEntries() {
+                std::array<std::pair<std::uint64_t, std::size_t>, size> entries{};
+                const std::uint64_t dims[] = {Dimension::of<SiTs>().packed()...};
+                for (std::size_t i = 0; i < size; ++i) {
+                    std::size_t j = i;
+                    for (; j > 0 && entries[j - 1].first > dims[i]; --j) {
+                        entries[j] = entries[j - 1];
+                    }
+                    entries[j] = {dims[i], i};
+                }
+                return entries;
+            }
+
+            /**
+             * Checks whether all types have a different unit.
+             * @return true if all dimensions are unique
+             */
+            static constexpr auto unique() -> bool {
+                for (std::size_t i = 1; i < size; ++i) {
+                    if (entries[i - 1].first == entries[i].first) {
+                        return false;
+                    }
+                }
+                return true;
+            }
+
+            static constexpr auto entries = makeEntries();             ///< Sorted dimensions
+            static constexpr Fn functions[size] = {&call<SiTs>...}; ///< Functions in order of SiTs
+        };
+    } // namespace detail
+
+    /**
+     * Call a function with the value converted to the static SI type of the same unit. The function needs to be
+     * callable with all types.
+     * @tparam SiTs all SI types which are considered, the units need to be unique
+     * @tparam T the underlying type
+     * @tparam F the type of the function
+     * @param value the dynamic value
+     * @param f the function
+     * @return true if one of the types matched the unit of the value and f was called, otherwise false
+     */
+    template<typename... SiTs, typename T, typename F>
+    auto dispatch(const DynamicSi<T> &value, F &&f) -> bool {
+        static_assert(sizeof...(SiTs) > 0, "dispatch requires at least one type");
+        static_assert((std::is_same_v<typename SiTs::type, T> && ...), "Underlying types do not match");
+        using Table = detail::DispatchTable<std::remove_reference_t<F>, T, SiTs...>;
+        static_assert(Table::unique(), "Types for dispatch need to have different units");
+
+        const auto key = value.dimension().packed();
+        std::size_t lo = 0;
+        std::size_t hi = Table::size;
+        while (lo < hi) {
+            const auto mid = (lo + hi) / 2;
+            if (Table::entries[mid].first < key) {
+                lo = mid + 1;
+            } else {
+                hi = mid;
+            }
+        }
+        if (lo == Table::size || Table::entries[lo].first != key) {
+            return false;
+        }
+        Table::functions[Table::entries[lo].second](value.value(), f);
+        return true;
+    }
+} // namespace si
+
+#endif
@@ -0,0 +1,489 @@
+/**
+ * @file SiExpression.hpp
+ * @author paul
+ * @date 17.10.26
+ * @brief Expression templates for lazy element-wise arithmetic on arrays and spans of SI values. Requires C++20.
+ * @ingroup SI
+ */
+#ifndef SI_SIEXPRESSION_HPP
+#define SI_SIEXPRESSION_HPP
+
+#include <cassert>
+#include <cstddef>
+#include <span>
+#include <type_traits>
+#include <utility>
+
+#include "SiImpl.hpp"
+#include "SiStl.hpp"
+
+namespace si {
+    template<typename SiT>
+    class ArrayView;
+
+    /**
+     * Type trait to check whether a type is an array (i.e. Array or ArrayView) of SI values.
+     * @tparam T the type to check.
+     */
+    template<typename T>
+    struct IsSiArray {
+        /**
+         * Type is not an array of SI values.
+         */
+        static constexpr auto val = false;
+    };
+
+    /**
+     * Type trait to check whether a type is a (not yet evaluated) element-wise expression.
+     * @tparam T the type to check.
+     */
+    template<typename T>
+    struct IsSiExpression {
+        /**
+         * Type is not an expression.
+         */
+        static constexpr auto val = false;
+    };
+
+    /**
+     * Type trait to check whether a type is a span of SI values.
+     * @tparam T the type to check.
+     */
+    template<typename T>
+    struct IsSiSpan {
+        /**
+         * Type is not a span of SI values.
+         */
+        static constexpr auto val = false;
+    };
+
+    /**
+     * Specialization of type trait to check whether a type is a span of SI values for spans.
+     * @tparam SiT the (possibly const) SI type of the elements
+     * @tparam Extent the extent of the span
+     */
+    template<typename SiT, std::size_t Extent>
+    struct IsSiSpan<std::span<SiT, Extent>> {
+        /**
+         * Type is a span of SI values if the elements are SI values.
+         */
+        static constexpr auto val = IsSi<std::remove_const_t<SiT>>::val;
+    };
+
+    namespace detail {
+        /**
+         * Checks whether a type provides one value per element, i.e. it is an array, a span or an expression.
+         */
+        template<typename T>
+        constexpr auto isRange = IsSiArray<T>::val || IsSiExpression<T>::val || IsSiSpan<T>::val;
+
+        /**
+         * Checks whether a type can be used as operand of an element-wise expression, single values are broadcast
+         * to all elements.
+         */
+        template<typename T>
+        constexpr auto isOperand = isRange<T> || IsSi<T>::val || std::is_arithmetic_v<T>;
+
+        /**
+         * Checks whether two operands form an element-wise expression: at least one has to provide one value per
+         * element.
+         */
+        template<typename Lhs, typename Rhs>
+        constexpr auto isElementwise = isOperand<Lhs> && isOperand<Rhs> && (isRange<Lhs> || isRange<Rhs>);
+
+        /**
+         * Access the i-th element of an operand of an element-wise expression.
+         * @tparam Operand the type of the operand
+         * @param operand the operand
+         * @param i the index
+         * @return the i-th element, single values are returned unchanged
+         */
+        template<typename Operand>
+        constexpr auto elementAt(const Operand &operand, std::size_t i) {
+            if constexpr (IsSiArray<Operand>::val) {
+                return typename Operand::value_type{operand.data()[i]};
+            } else if constexpr (IsSiExpression<Operand>::val) {
+                return operand.eval(i);
+            } else if constexpr (IsSiSpan<Operand>::val) {
+                return std::remove_const_t<typename Operand::element_type>{operand[i]};
+            } else {
+                return operand;
+            }
+        }
+
+        /**
+         * Number of elements of two operands, all operands providing one value per element need to be of the same
+         * size.
+         * @return the common size of all operands
+         */
+        template<typename Lhs, typename Rhs>
+        constexpr auto commonSize(const Lhs &lhs, const Rhs &rhs) -> std::size_t {
+            if constexpr (isRange<Lhs> && isRange<Rhs>) {
+                assert(lhs.size() == rhs.size() && "Element-wise operation on operands of different size");
+                return lhs.size();
+            } else if constexpr (isRange<Lhs>) {
+                return lhs.size();
+            } else {
+                return rhs.size();
+            }
+        }
+
+        /**
+         * Type used to store an operand inside of an expression: arrays passed as lvalue are referenced using a
+         * read-only view, everything else (expressions, single values and arrays passed as rvalue) is stored by
+         * value.
+         */
+        template<typename T, typename Decayed = std::remove_cv_t<std::remove_reference_t<T>>,
+                 bool isView = IsSiArray<Decayed>::val && std::is_lvalue_reference_v<T>>
+        struct StoredType {
+            using type = Decayed; ///< Operand is stored by value
+        };
+
+        /**
+         * Specialization for arrays passed as lvalue which are referenced using a read-only view.
+         */
+        template<typename T, typename Decayed>
+        struct StoredType<T, Decayed, true> {
+            using type = ArrayView<const typename Decayed::value_type>; ///< Operand is stored as view
+        };
+
+        /**
+         * @see StoredType
+         */
+        template<typename T>
+        using Stored = typename StoredType<T>::type;
+
+        /**
+         * Convert an operand to the type which is stored in the expression.
+         * @tparam T the (forwarding reference) type of the operand
+         * @param operand the operand
+         * @return the stored representation
+         */
+        template<typename T>
+        constexpr auto store(T &&operand) -> Stored<T> {
+            if constexpr (IsSiArray<std::remove_cv_t<std::remove_reference_t<T>>>::val &&
+                          std::is_lvalue_reference_v<T>) {
+                return Stored<T>{std::span{operand.data(), operand.size()}};
+            } else {
+                return std::forward<T>(operand);
+            }
+        }
+
+        /**
+         * Addition of two elements.
+         */
+        struct Plus {
+            template<typename A, typename B>
+            constexpr auto operator()(A a, B b) const {
+                return a + b;
+            }
+        };
+
+        /**
+         * Subtraction of two elements.
+         */
+        struct Minus {
+            template<typename A, typename B>
+            constexpr auto operator()(A a, B b) const {
+                return a - b;
+            }
+        };
+
+        /**
+         * Multiplication of two elements.
+         */
+        struct Multiplies {
+            template<typename A, typename B>
+            constexpr auto operator()(A a, B b) const {
+                return a * b;
+            }
+        };
+
+        /**
+         * Division of two elements.
+         */
+        struct Divides {
+            template<typename A, typename B>
+            constexpr auto operator()(A a, B b) const {
+                return a / b;
+            }
+        };
+
+        /**
+         * Unary minus of an element.
+         */
+        struct Negate {
+            template<typename A>
+            constexpr auto operator()(A a) const {
+                return -a;
+            }
+        };
+
+        /**
+         * Square root of an element using the implementation in SiStl.hpp.
+         */
+        struct Sqrt {
+            template<typename A>
+            auto operator()(A a) const {
+                return std::sqrt(a);
+            }
+        };
+
+        /**
+         * Absolute value of an element using the implementation in SiStl.hpp.
+         */
+        struct Abs {
+            template<typename A>
+            auto operator()(A a) const {
+                return std::abs(a);
+            }
+        };
+    } // namespace detail
+
+    /**
+     * Lazy element-wise binary operation, the operation is only performed once the expression gets evaluated.
+     * @tparam Op the operation on single elements
+     * @tparam Lhs the stored type of the left operand
+     * @tparam Rhs the stored type of the right operand
+     */
+    template<typename Op, typename Lhs, typename Rhs>
+    class BinaryExpression {
+      public:
+        /**
+         * Type of a single element of the result, the unit is checked by the operators of Si.
+         */
+        using value_type = decltype(Op{}(detail::elementAt(std::declval<Lhs>(), 0),
+                                         detail::elementAt(std::declval<Rhs>(), 0)));
+
+        /**
+         * Create the expression from both operands.
+         * @param lhs the left operand
+         * @param rhs the right operand
+         */
+        constexpr BinaryExpression(Lhs lhs, Rhs rhs) : lhs{std::move(lhs)}, rhs{std::move(rhs)} {
+        }
+
+        /**
+         * Number of elements of the result.
+         * @return the size of the operands
+         */
+        [[nodiscard]] constexpr auto size() const -> std::size_t {
+            return detail::commonSize(lhs, rhs);
+        }
+
+        /**
+         * Calculate a single element of the result.
+         * @param i the index
+         * @return the i-th element
+         */
+        constexpr auto eval(std::size_t i) const -> value_type {
+            return Op{}(detail::elementAt(lhs, i), detail::elementAt(rhs, i));
+        }
+
+      private:
+        Lhs lhs;
+        Rhs rhs;
+    };
+
+    /**
+     * Lazy element-wise unary operation, the operation is only performed once the expression gets evaluated.
+     * @tparam Op the operation on single elements
+     * @tparam Arg the stored type of the operand
+     */
+    template<typename Op, typename Arg>
+    class UnaryExpression {
+      public:
+        /**
+         * Type of a single element of the result, the unit is checked by the implementation of the operation.
+         */
+        using value_type = decltype(Op{}(detail::elementAt(std::declval<Arg>(), 0)));
+
+        /**
+         * Create the expression from the operand.
+         * @param arg the operand
+         */
+        constexpr explicit UnaryExpression(Arg arg) : arg{std::move(arg)} {
+        }
+
+        /**
+         * Number of elements of the result.
+         * @return the size of the operand
+         */
+        [[nodiscard]] constexpr auto size() const -> std::size_t {
+            return arg.size();
+        }
+
+        /**
+         * Calculate a single element of the result.
+         * @param i the index
+         * @return the i-th element
+         */
+        constexpr auto eval(std::size_t i) const -> value_type {
+            return Op{}(detail::elementAt(arg, i));
+        }
+
+      private:
+        Arg arg;
+    };
+
+    /**
+     * Specialization of type trait to check whether a type is an expression for binary expressions.
+     */
+    template<typename Op, typename Lhs, typename Rhs>
+    struct IsSiExpression<BinaryExpression<Op, Lhs, Rhs>> {
+        /**
+         * Type is an expression.
+         */
+        static constexpr auto val = true;
+    };
+
+    /**
+     * Specialization of type trait to check whether a type is an expression for unary expressions.
+     */
+    template<typename Op, typename Arg>
+    struct IsSiExpression<UnaryExpression<Op, Arg>> {
+        /**
+         * Type is an expression.
+         */
+        static constexpr auto val = true;
+    };
+
+    namespace detail {
+        /**
+         * Create a binary expression from two operands.
+         */
+        template<typename Op, typename Lhs, typename Rhs>
+        constexpr auto makeExpression(Lhs &&lhs, Rhs &&rhs) {
+            return BinaryExpression<Op, Stored<Lhs>, Stored<Rhs>>{store(std::forward<Lhs>(lhs)),
+                                                                   store(std::forward<Rhs>(rhs))};
+        }
+
+        /**
+         * Create a unary expression from an operand.
+         */
+        template<typename Op, typename Arg>
+        constexpr auto makeExpression(Arg &&arg) {
+            return UnaryExpression<Op, Stored<Arg>>{store(std::forward<Arg>(arg))};
+        }
+
+        /**
+         * Evaluate an expression in a single loop and write the result to memory of the underlying type. All
+         * operations of the expression are fused into the loop body, so every operand is only read once.
+         * @tparam SiT the SI type of the destination, needs to match the unit of the expression
+         * @tparam Expr the type of the expression
+         * @param expr the expression
+         * @param out pointer to the destination, needs to provide space for expr.size() elements
+         */
+        template<typename SiT, typename Expr>
+        void evaluateInto(const Expr &expr, typename SiT::type *out) {
+            static_assert(std::is_same_v<typename Expr::value_type, SiT>,
+                          "The unit of the expression does not match the unit of the destination");
+            const auto size = expr.size();
+            for (std::size_t i = 0; i < size; ++i) {
+                out[i] = static_cast<typename SiT::type>(expr.eval(i));
+            }
+        }
+    } // namespace detail
+
+    /**
+     * Lazy element-wise sum of arrays, spans, expressions or single values of the same unit.
+     * @param lhs the first summand
+     * @param rhs the second summand
+     * @return an expression for the sum of all elements
+     */
+    template<typename Lhs, typename Rhs,
+             std::enable_if_t<detail::isElementwise<std::decay_t<Lhs>, std::decay_t<Rhs>>, bool> = true>
+    constexpr auto operator+(Lhs &&lhs, Rhs &&rhs) {
+        return detail::makeExpression<detail::Plus>(std::forward<Lhs>(lhs), std::forward<Rhs>(rhs));
+    }
+
+    /**
+     * Lazy element-wise difference of arrays, spans, expressions or single values of the same unit.
+     * @param lhs the minuend
+     * @param rhs the subtrahend
+     * @return an expression for the difference of all elements
+     */
+    template<typename Lhs, typename Rhs,
+             std::enable_if_t<detail::isElementwise<std::decay_t<Lhs>, std::decay_t<Rhs>>, bool> = true>
+    constexpr auto operator-(Lhs &&lhs, Rhs &&rhs) {
+        return detail::makeExpression<detail::Minus>(std::forward<Lhs>(lhs), std::forward<Rhs>(rhs));
+    }
+
+    /**
+     * Lazy element-wise product of arrays, spans, expressions or single values, the unit of the result is the
+     * product of the units.
+     * @param lhs the first factor
+     * @param rhs the second factor
+     * @return an expression for the product of all elements
+     */
+    template<typename Lhs, typename Rhs,
+             std::enable_if_t<detail::isElementwise<std::decay_t<Lhs>, std::decay_t<Rhs>>, bool> = true>
+    constexpr auto operator*(Lhs &&lhs, Rhs &&rhs) {
+        return detail::makeExpression<detail::Multiplies>(std::forward<Lhs>(lhs), std::forward<Rhs>(rhs));
+    }
+
+    /**
+     * Lazy element-wise quotient of arrays, spans, expressions or single values, the unit of the result is the
+     * quotient of the units.
+     * @param lhs the dividend
+     * @param rhs the divisor
+     * @return an expression for the quotient of all elements
+     */
+    template<typename Lhs, typename Rhs,
+             std::enable_if_t<detail::isElementwise<std::decay_t<Lhs>, std::decay_t<Rhs>>, bool> = true>
+    constexpr auto operator/(Lhs &&lhs, Rhs &&rhs) {
+        return detail::makeExpression<detail::Divides>(std::forward<Lhs>(lhs), std::forward<Rhs>(rhs));
+    }
+
+    /**
+     * Lazy element-wise unary minus.
+     * @param arg the array, span or expression
+     * @return an expression for the negative of all elements
+     */
+    template<typename Arg, std::enable_if_t<detail::isRange<std::decay_t<Arg>>, bool> = true>
+    constexpr auto operator-(Arg &&arg) {
+        return detail::makeExpression<detail::Negate>(std::forward<Arg>(arg));
+    }
+
+    /**
+     * Evaluate an expression and write the result to a span of SI values.
+     * @tparam SiT the SI type of the destination, needs to match the unit of the expression
+     * @tparam Expr the type of the expression
+     * @param expr the expression
+     * @param out the destination, needs to be of the same size as the expression
+     */
+    template<typename SiT, typename Expr, std::enable_if_t<IsSiExpression<Expr>::val, bool> = true>
+    void evaluate(const Expr &expr, std::span<SiT> out) {
+        static_assert(std::is_same_v<typename Expr::value_type, SiT>,
+                      "The unit of the expression does not match the unit of the destination");
+        assert(expr.size() == out.size() && "Destination is of different size than the expression");
+        for (std::size_t i = 0; i < out.size(); ++i) {
+            out[i] = expr.eval(i);
+        }
+    }
+} // namespace si
+
+namespace std {
+    /**
+     * Lazy element-wise square root of an array, span or expression, the unit is checked by the implementation for
+     * a single value.
+     * @param arg the argument
+     * @return an expression for the square root of all elements
+     */
+    template<typename Arg, std::enable_if_t<si::detail::isRange<std::decay_t<Arg>>, bool> = true>
+    auto sqrt(Arg &&arg) {
+        return si::detail::makeExpression<si::detail::Sqrt>(std::forward<Arg>(arg));
+    }
+
+    /**
+     * Lazy element-wise absolute value of an array, span or expression.
+     * @param arg the argument
+     * @return an expression for the absolute value of all elements
+     */
+    template<typename Arg, std::enable_if_t<si::detail::isRange<std::decay_t<Arg>>, bool> = true>
+    auto abs(Arg &&arg) {
+        return si::detail::makeExpression<si::detail::Abs>(std::forward<Arg>(arg));
+    }
+} // namespace std
+
+#endif
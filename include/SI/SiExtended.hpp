@@ -14,9 +14,15 @@
 #include "SiGenerator.hpp"
 #include "SiImpl.hpp"
 
-SI_CREATE_UNIT(Speed, speed, 1, 0, -1, 0, 0, 0, 0)
-SI_CREATE_UNIT(Acceleration, acceleration, 1, 0, -2, 0, 0, 0, 0)
-SI_CREATE_UNIT(Volt, volt, 2, 1, -3, -1, 0, 0, 0)
-SI_CREATE_UNIT(Hertz, hertz, 0, 0, -1, 0, 0, 0, 0)
+/**
+ * List of the derived units in the format X(Name, name, m, kg, s, A, K, Mol, CD), see SI_BASE_UNITS.
+ */
+#define SI_EXTENDED_UNITS(X) /* NOLINT(cppcoreguidelines-macro-usage) */                                               \
+    X(Speed, speed, 1, 0, -1, 0, 0, 0, 0)                                                                              \
+    X(Acceleration, acceleration, 1, 0, -2, 0, 0, 0, 0)                                                                \
+    X(Volt, volt, 2, 1, -3, -1, 0, 0, 0)                                                                               \
+    X(Hertz, hertz, 0, 0, -1, 0, 0, 0, 0)
+
+SI_EXTENDED_UNITS(SI_CREATE_UNIT)
 
 #endif
@@ -0,0 +1,628 @@
+/**
+ * @file SiFixed.hpp
+ * @author paul
+ * @date 17.10.26
+ * @brief Fixed point numbers as underlying type of SI types, for example for microcontrollers without FPU.
+ * @ingroup SI
+ */
+#ifndef SI_SIFIXED_HPP
+#define SI_SIFIXED_HPP
+
+#include <climits>
+#include <cstdint>
+#include <limits>
+#include <ostream>
+#include <type_traits>
+
+#include "SiBase.hpp"
+#include "SiExtended.hpp"
+#include "SiGenerator.hpp"
+#include "SiImpl.hpp"
+
+namespace si {
+    namespace detail {
+        /**
+         * Signed integer type with twice the number of bits, used for intermediate results.
+         * @tparam Int the integer type
+         */
+        template<typename Int>
+        struct Wider;
+
+        /**
+         * Wider type for 8 bit integers.
+         */
+        template<>
+        struct Wider<std::int8_t> {
+            using type = std::int16_t; ///< The wider type
+        };
+
+        /**
+         * Wider type for 16 bit integers.
+         */
+        template<>
+        struct Wider<std::int16_t> {
+            using type = std::int32_t; ///< The wider type
+        };
+
+        /**
+         * Wider type for 32 bit integers.
+         */
+        template<>
+        struct Wider<std::int32_t> {
+            using type = std::int64_t; ///< The wider type
+        };
+
+        /**
+         * Convert an intermediate result to the integer type, values outside of the range are clamped.
+         * @tparam Int the integer type
+         * @tparam Wide the type of the intermediate result
+         * @param val the intermediate result
+         * @return the saturated value
+         */
+        template<typename Int, typename Wide>
+        constexpr auto saturate(Wide val) noexcept -> Int {
+            if (val > static_cast<Wide>(std::numeric_limits<Int>::max())) {
+                return std::numeric_limits<Int>::max();
+            }
+            if (val < static_cast<Wide>(std::numeric_limits<Int>::min())) {
+                return std::numeric_limits<Int>::min();
+            }
+            return static_cast<Int>(val);
+        }
+    } // namespace detail
+
+    /**
+     * Fixed point number (Q format) which can be used as underlying type of SI types. The value is stored as integer
+     * scaled by 2^FracBits, all operations only use integer arithmetic and saturate instead of overflowing. The
+     * scaling of products and quotients is a shift by a compile time constant.
+     * @tparam Int the signed integer type used for storage, at most 32 bits
+     * @tparam FracBits the number of fractional bits
+     */
+    template<typename Int, int FracBits>
+    class Fixed {
+        static_assert(std::is_integral_v<Int> && std::is_signed_v<Int>, "Fixed requires a signed integer type");
+        static_assert(sizeof(Int) <= sizeof(std::int32_t), "Fixed supports integer types with at most 32 bits");
+        static_assert(FracBits >= 0 && FracBits < std::numeric_limits<Int>::digits,
+                      "Number of fractional bits needs to be less than the number of value bits");
+
+        using Wide = typename detail::Wider<Int>::type;
+
+        static constexpr Wide one = Wide{1} << FracBits;
+
+      public:
+        using int_type = Int;                   ///< The integer type used for storage
+        static constexpr int fracBits = FracBits; ///< The number of fractional bits
+
+        /**
+         * Create a fixed point number with value zero.
+         */
+        constexpr Fixed() noexcept = default;
+
+        /**
+         * Create a fixed point number from an integer, saturates if the value is out of range.
+         * @tparam I the integer type
+         * @param val the value
+         */
+        template<typename I, std::enable_if_t<std::is_integral_v<I>, bool> = true>
+        constexpr explicit Fixed(I val) noexcept : raw_{fromIntegral(val)} {
+        }
+
+        /**
+         * Create a fixed point number from a floating point number, the value is rounded to the nearest
+         * representable value and saturates if it is out of range.
+         * @tparam F the floating point type
+         * @param val the value
+         */
+        template<typename F, std::enable_if_t<std::is_floating_point_v<F>, bool> = true>
+        constexpr explicit Fixed(F val) noexcept : raw_{fromFloating(val)} {
+        }
+
+        /**
+         * Create a fixed point number from its raw representation.
+         * @param raw the value scaled by 2^FracBits
+         * @return the fixed point number
+         */
+        static constexpr auto fromRaw(Int raw) noexcept -> Fixed {
+            Fixed res;
+            res.raw_ = raw;
+            return res;
+        }
+
+        /**
+         * Get the raw representation.
+         * @return the value scaled by 2^FracBits
+         */
+        [[nodiscard]] constexpr auto raw() const noexcept -> Int {
+            return raw_;
+        }
+
+        /**
+         * Convert to an integer, the fractional part is truncated (rounding towards zero).
+         * @tparam I the integer type
+         * @return the integer part of the value
+         */
+        template<typename I, std::enable_if_t<std::is_integral_v<I>, bool> = true>
+        constexpr explicit operator I() const noexcept {
+            return static_cast<I>(raw_ / one);
+        }
+
+        /**
+         * Convert to a floating point number.
+         * @tparam F the floating point type
+         * @return the value
+         */
+        template<typename F, std::enable_if_t<std::is_floating_point_v<F>, bool> = true>
+        constexpr explicit operator F() const noexcept {
+            return static_cast<F>(raw_) / static_cast<F>(one);
+        }
+
+        /**
+         * Saturating addition.
+         * @param rhs the other summand
+         * @return the sum
+         */
+        constexpr auto operator+(Fixed rhs) const noexcept -> Fixed {
+            return fromRaw(detail::saturate<Int>(Wide{raw_} + Wide{rhs.raw_}));
+        }
+
+        /**
+         * Saturating subtraction.
+         * @param rhs the subtrahend
+         * @return the difference
+         */
+        constexpr auto operator-(Fixed rhs) const noexcept -> Fixed {
+            return fromRaw(detail::saturate<Int>(Wide{raw_} - Wide{rhs.raw_}));
+        }
+
+        /**
+         * Saturating negation.
+         * @return the negated value
+         */
+        constexpr auto operator-() const noexcept -> Fixed {
+            return fromRaw(detail::saturate<Int>(-Wide{raw_}));
+        }
+
+        /**
+         * Saturating multiplication, the product is rounded to the nearest representable value.
+         * @param rhs the other factor
+         * @return the product
+         */
+        constexpr auto operator*(Fixed rhs) const noexcept -> Fixed {
+            auto product = Wide{raw_} * Wide{rhs.raw_};
+            if constexpr (FracBits > 0) {
+                product = (product + (Wide{1} << (FracBits - 1))) >> FracBits;
+            }
+            return fromRaw(detail::saturate<Int>(product));
+        }
+
+        /**
+         * Saturating division, the quotient is rounded to the nearest representable value. Division by zero
+         * saturates to the largest or smallest value depending on the sign of the dividend.
+         * @param rhs the divisor
+         * @return the quotient
+         */
+        constexpr auto operator/(Fixed rhs) const noexcept -> Fixed {
+            if (rhs.raw_ == 0) {
+                return fromRaw(raw_ < 0 ? std::numeric_limits<Int>::min() : std::numeric_limits<Int>::max());
+            }
+            const auto dividend = Wide{raw_} * one;
+            const auto divisor = Wide{rhs.raw_};
+            auto quotient = dividend / divisor;
+            const auto remainder = dividend % divisor;
+            if (2 * (remainder < 0 ? -remainder : remainder) >= (divisor < 0 ? -divisor : divisor)) {
+                quotient += (dividend < 0) == (divisor < 0) ? 1 : -1;
+            }
+            return fromRaw(detail::saturate<Int>(quotient));
+        }
+
+        /**
+         * Saturating addition.
+         * @param rhs the other summand
+         * @return reference to this
+         */
+        constexpr auto operator+=(Fixed rhs) noexcept -> Fixed & {
+            return *this = *this + rhs;
+        }
+
+        /**
+         * Saturating subtraction.
+         * @param rhs the subtrahend
+         * @return reference to this
+         */
+        constexpr auto operator-=(Fixed rhs) noexcept -> Fixed & {
+            return *this = *this - rhs;
+        }
+
+        /**
+         * Saturating multiplication.
+         * @param rhs the other factor
+         * @return reference to this
+         */
+        constexpr auto operator*=(Fixed rhs) noexcept -> Fixed & {
+            return *this = *this * rhs;
+        }
+
+        /**
+         * Saturating division.
+         * @param rhs the divisor
+         * @return reference to this
+         */
+        constexpr auto operator/=(Fixed rhs) noexcept -> Fixed & {
+            return *this = *this / rhs;
+        }
+
+        /**
+         * Equality of fixed point numbers.
+         * @param rhs the other value
+         * @return true if the values are equal
+         */
+        constexpr auto operator==(Fixed rhs) const noexcept -> bool {
+            return raw_ == rhs.raw_;
+        }
+
+        /**
+         * Non-Equality of fixed point numbers.
+         * @param rhs the other value
+         * @return true if the values are not equal
+         */
+        constexpr auto operator!=(Fixed rhs) const noexcept -> bool {
+            return raw_ != rhs.raw_;
+        }
+
+        /**
+         * Less than operator for fixed point numbers.
+         * @param rhs the other value
+         * @return true if this is less than rhs
+         */
+        constexpr auto operator<(Fixed rhs) const noexcept -> bool {
+            return raw_ < rhs.raw_;
+        }
+
+        /**
+         * Greater than operator for fixed point numbers.
+         * @param rhs the other value
+         * @return true if this is greater than rhs
+         */
+        constexpr auto operator>(Fixed rhs) const noexcept -> bool {
+            return raw_ > rhs.raw_;
+        }
+
+        /**
+         * Less than-equal operator for fixed point numbers.
+         * @param rhs the other value
+         * @return true if this is less or equal than rhs
+         */
+        constexpr auto operator<=(Fixed rhs) const noexcept -> bool {
+            return raw_ <= rhs.raw_;
+        }
+
+        /**
+         * Greater than-equal operator for fixed point numbers.
+         * @param rhs the other value
+         * @return true if this is greater or equal than rhs
+         */
+        constexpr auto operator>=(Fixed rhs) const noexcept -> bool {
+            return raw_ >= rhs.raw_;
+        }
+
+      private:
+        template<typename I>
+        static constexpr auto fromIntegral(I val) noexcept -> Int {
+            constexpr auto maxInt = std::numeric_limits<Int>::max() / one;
+            constexpr auto minInt = std::numeric_limits<Int>::min() / one;
+            if constexpr (std::is_signed_v<I>) {
+                if (static_cast<long long>(val) < minInt) {
+                    return std::numeric_limits<Int>::min();
+                }
+                if (static_cast<long long>(val) > maxInt) {
+                    return std::numeric_limits<Int>::max();
+                }
+            } else {
+                if (static_cast<unsigned long long>(val) > static_cast<unsigned long long>(maxInt)) {
+                    return std::numeric_limits<Int>::max();
+                }
+            }
+            return static_cast<Int>(static_cast<Wide>(val) * one);
+        }
+
+        template<typename F>
+        static constexpr auto fromFloating(F val) noexcept -> Int {
+            if (val != val) { // NaN
+                return 0;
+            }
+            const auto scaled = val * static_cast<F>(one);
+            if (scaled >= static_cast<F>(std::numeric_limits<Int>::max())) {
+                return std::numeric_limits<Int>::max();
+            }
+            if (scaled <= static_cast<F>(std::numeric_limits<Int>::min())) {
+                return std::numeric_limits<Int>::min();
+            }
+            return static_cast<Int>(scaled < 0 ? scaled - F{0.5} : scaled + F{0.5});
+        }
+
+        Int raw_{};
+    };
+
+    /**
+     * Print a fixed point number, the value is printed as floating point number.
+     * @tparam Int the integer type
+     * @tparam FracBits the number of fractional bits
+     * @param ostream the stream to write to
+     * @param fixed the fixed point number
+     * @return the ostream with the number printed to it
+     */
+    template<typename Int, int FracBits>
+    auto operator<<(std::ostream &ostream, Fixed<Int, FracBits> fixed) -> std::ostream & {
+        return ostream << static_cast<double>(fixed);
+    }
+
+    namespace detail {
+        /**
+         * Decimal number as written in a literal: mantissa * 10^exp.
+         */
+        struct DecimalLiteral {
+            unsigned long long mantissa = 0; ///< All digits of the literal
+            int exp = 0;                     ///< Decimal exponent
+            bool valid = true;               ///< False if the literal is not a decimal number
+        };
+
+        /**
+         * Parse the characters of a numeric literal, supports integer and floating point literals in decimal
+         * notation (including exponents and digit separators). Digits beyond the precision of the mantissa are
+         * ignored.
+         * @tparam chars the characters of the literal
+         * @return the parsed literal
+         */
+        template<char... chars>
+        constexpr auto parseDecimalLiteral() -> DecimalLiteral {
+            constexpr char str[] = {chars..., '\0'};
+            DecimalLiteral res;
+            bool fraction = false;
+            bool exponent = false;
+            bool negativeExp = false;
+            bool octal = str[0] == '0' && sizeof...(chars) > 1;
+            int explicitExp = 0;
+            for (std::size_t i = 0; i < sizeof...(chars); ++i) {
+                const char c = str[i];
+                if (c == '\'') {
+                    continue;
+                }
+                if (exponent) {
+                    if (c == '-' || c == '+') {
+                        negativeExp = c == '-';
+                    } else if (c >= '0' && c <= '9' && explicitExp < 1000) {
+                        explicitExp = explicitExp * 10 + (c - '0');
+                    } else {
+                        res.valid = false;
+                    }
+                } else if (c == '.') {
+                    res.valid = res.valid && not fraction;
+                    fraction = true;
+                    octal = false;
+                } else if (c == 'e' || c == 'E') {
+                    exponent = true;
+                    octal = false;
+                } else if (c >= '0' && c <= '9') {
+                    const auto digit = static_cast<unsigned long long>(c - '0');
+                    if (res.mantissa > (ULLONG_MAX - digit) / 10) {
+                        res.exp += fraction ? 0 : 1;
+                    } else {
+                        res.mantissa = res.mantissa * 10 + digit;
+                        res.exp -= fraction ? 1 : 0;
+                    }
+                } else {
+                    res.valid = false; // Hexadecimal or binary literal
+                }
+            }
+            res.valid = res.valid && not octal;
+            res.exp += negativeExp ? -explicitExp : explicitExp;
+            return res;
+        }
+
+        /**
+         * Raw representation of a fixed point literal.
+         * @tparam Int the integer type of the fixed point number
+         */
+        template<typename Int>
+        struct FixedLiteral {
+            Int raw = 0;      ///< The value scaled by 2^FracBits
+            bool fits = true; ///< False if the value is out of range of the fixed point type
+        };
+
+        /**
+         * Convert a decimal literal to the raw representation of a fixed point number using integer arithmetic only,
+         * the value is rounded to the nearest representable value.
+         * @tparam FixedT the fixed point type
+         * @param literal the decimal literal
+         * @param prefixExp the decimal exponent of the unit prefix
+         * @return the raw representation
+         */
+        template<typename FixedT>
+        constexpr auto toFixedLiteral(DecimalLiteral literal, int prefixExp) -> FixedLiteral<typename FixedT::int_type> {
+            using Int = typename FixedT::int_type;
+            constexpr auto maxRaw = static_cast<unsigned long long>(std::numeric_limits<Int>::max());
+            constexpr unsigned long long maxDenominator = 1'000'000'000'000'000'000ULL;
+            auto num = literal.mantissa;
+            unsigned long long den = 1;
+            for (int exp = literal.exp + prefixExp; exp > 0; --exp) {
+                if (num > ULLONG_MAX / 10) {
+                    return {0, false};
+                }
+                num *= 10;
+            }
+            for (int exp = literal.exp + prefixExp; exp < 0; ++exp) {
+                if (den < maxDenominator) {
+                    den *= 10;
+                } else {
+                    num /= 10; // Below the resolution of every fixed point type
+                }
+            }
+
+            const auto integer = num / den;
+            auto remainder = num % den;
+            if (integer > (maxRaw >> FixedT::fracBits)) {
+                return {0, false};
+            }
+            // Long division for the fractional bits, remainder < den <= 10^18 so doubling can not overflow
+            unsigned long long raw = integer;
+            for (int bit = 0; bit < FixedT::fracBits; ++bit) {
+                remainder *= 2;
+                raw = raw * 2 + (remainder >= den ? 1 : 0);
+                remainder -= remainder >= den ? den : 0;
+            }
+            raw += 2 * remainder >= den ? 1 : 0;
+            if (raw > maxRaw) {
+                return {0, false};
+            }
+            return {static_cast<Int>(raw), true};
+        }
+
+        /**
+         * Create a fixed point number from the characters of a literal at compile time.
+         * @tparam FixedT the fixed point type
+         * @tparam prefixExp the decimal exponent of the unit prefix
+         * @tparam chars the characters of the literal
+         * @return the fixed point number
+         */
+        template<typename FixedT, int prefixExp, char... chars>
+        constexpr auto fixedLiteral() -> FixedT {
+            constexpr auto literal = parseDecimalLiteral<chars...>();
+            static_assert(literal.valid, "Fixed point literals need to be decimal numbers");
+            constexpr auto res = toFixedLiteral<FixedT>(literal, prefixExp);
+            static_assert(res.fits, "Literal is out of range of the fixed point type");
+            return FixedT::fromRaw(res.raw);
+        }
+    } // namespace detail
+} // namespace si
+
+/**
+ * Specialization of std::numeric_limits for fixed point numbers.
+ * @tparam Int the integer type
+ * @tparam FracBits the number of fractional bits
+ */
+template<typename Int, int FracBits>
+class std::numeric_limits<si::Fixed<Int, FracBits>> {
+    using FixedT = si::Fixed<Int, FracBits>;
+
+  public:
+    static constexpr bool is_specialized = true;                    ///< Limits are available
+    static constexpr bool is_signed = true;                         ///< Fixed point numbers are signed
+    static constexpr bool is_integer = false;                       ///< Fixed point numbers have a fractional part
+    static constexpr bool is_exact = true;                          ///< Representation is exact
+    static constexpr int digits = std::numeric_limits<Int>::digits; ///< Number of value bits
+    static constexpr int digits10 = digits * 30103 / 100000;        ///< Decimal digits which are represented exactly
+    static constexpr int max_digits10 = 0;                          ///< Only meaningful for floating point types
+    static constexpr int radix = 2;                                 ///< Base of the representation
+    static constexpr int min_exponent = 0;                          ///< There is no exponent
+    static constexpr int min_exponent10 = 0;                        ///< There is no exponent
+    static constexpr int max_exponent = 0;                          ///< There is no exponent
+    static constexpr int max_exponent10 = 0;                        ///< There is no exponent
+    static constexpr bool has_infinity = false;                     ///< There is no representation of infinity
+    static constexpr bool has_quiet_NaN = false;                    ///< There is no representation of NaN
+    static constexpr bool has_signaling_NaN = false;                ///< There is no representation of NaN
+    static constexpr std::float_denorm_style has_denorm = std::denorm_absent; ///< There are no subnormal values
+    static constexpr bool has_denorm_loss = false;                  ///< There are no subnormal values
+    static constexpr bool is_iec559 = false;                        ///< Not an IEEE 754 type
+    static constexpr bool is_bounded = true;                        ///< The set of values is finite
+    static constexpr bool is_modulo = false;                        ///< Operations saturate instead of wrapping
+    static constexpr bool traps = false;                            ///< No operation traps, division by zero saturates
+    static constexpr bool tinyness_before = false;                  ///< Only meaningful for floating point types
+    static constexpr std::float_round_style round_style = std::round_to_nearest; ///< Products are rounded to nearest
+
+    /**
+     * Smallest value.
+     * @return the smallest value
+     */
+    static constexpr auto min() noexcept -> FixedT {
+        return FixedT::fromRaw(std::numeric_limits<Int>::min());
+    }
+
+    /**
+     * Smallest value.
+     * @return the smallest value
+     */
+    static constexpr auto lowest() noexcept -> FixedT {
+        return min();
+    }
+
+    /**
+     * Largest value.
+     * @return the largest value
+     */
+    static constexpr auto max() noexcept -> FixedT {
+        return FixedT::fromRaw(std::numeric_limits<Int>::max());
+    }
+
+    /**
+     * Difference between one and the next representable value.
+     * @return the resolution of the fixed point type
+     */
+    static constexpr auto epsilon() noexcept -> FixedT {
+        return FixedT::fromRaw(1);
+    }
+
+    /**
+     * Maximal rounding error of multiplication and division in units of epsilon, as for floating point types.
+     * @return 0.5 or 1 if there are no fractional bits
+     */
+    static constexpr auto round_error() noexcept -> FixedT { // NOLINT(readability-identifier-naming)
+        return FixedT::fromRaw(FracBits > 0 ? Int{1} << (FracBits - 1) : Int{1});
+    }
+
+    /**
+     * Not meaningful as there is no representation of infinity.
+     * @return zero
+     */
+    static constexpr auto infinity() noexcept -> FixedT {
+        return FixedT::fromRaw(0);
+    }
+
+    /**
+     * Not meaningful as there is no representation of NaN.
+     * @return zero
+     */
+    static constexpr auto quiet_NaN() noexcept -> FixedT { // NOLINT(readability-identifier-naming) consistent with STL
+        return FixedT::fromRaw(0);
+    }
+
+    /**
+     * Not meaningful as there is no representation of NaN.
+     * @return zero
+     */
+    static constexpr auto signaling_NaN() noexcept -> FixedT { // NOLINT(readability-identifier-naming)
+        return FixedT::fromRaw(0);
+    }
+
+    /**
+     * Not meaningful as there are no subnormal values.
+     * @return zero
+     */
+    static constexpr auto denorm_min() noexcept -> FixedT { // NOLINT(readability-identifier-naming) consistent with STL
+        return FixedT::fromRaw(0);
+    }
+};
+
+#ifndef SI_DEFAULT_FIXED_TYPE
+    #define SI_DEFAULT_FIXED_TYPE si::Fixed<std::int32_t, 16> ///< Default fixed point type for the literals (Q15.16).
+#endif
+
+namespace si {
+    /**
+     * Fixed point type for all fixed point literals.
+     */
+    using default_fixed_type = SI_DEFAULT_FIXED_TYPE;
+} // namespace si
+
+SI_CREATE_FIXED_LITERALS(Meter, meter)
+SI_CREATE_FIXED_LITERALS(Kilogram, kilogram)
+SI_CREATE_FIXED_LITERALS(Second, second)
+SI_CREATE_FIXED_LITERALS(Ampere, ampere)
+SI_CREATE_FIXED_LITERALS(Kelvin, kelvin)
+SI_CREATE_FIXED_LITERALS(Mole, mole)
+SI_CREATE_FIXED_LITERALS(Candela, candela)
+SI_CREATE_FIXED_LITERALS(Speed, speed)
+SI_CREATE_FIXED_LITERALS(Acceleration, acceleration)
+SI_CREATE_FIXED_LITERALS(Volt, volt)
+SI_CREATE_FIXED_LITERALS(Hertz, hertz)
+
+#endif
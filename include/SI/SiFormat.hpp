@@ -0,0 +1,56 @@
+/**
+ * @file SiFormat.hpp
+ * @author paul
+ * @date 17.10.26
+ * @brief Support for formatting SI types using std::format, only available if the standard library provides
+ * std::format.
+ * @ingroup SI
+ */
+#ifndef SI_SIFORMAT_HPP
+#define SI_SIFORMAT_HPP
+
+#include <algorithm>
+
+#if __has_include(<format>)
+    #include <format>
+#endif
+
+#include "SiImpl.hpp"
+#include "SiPrinterExtended.hpp"
+#include "SiUnitString.hpp"
+
+#if __cpp_lib_format
+/**
+ * Formatter for SI types, the value is formatted using the formatter of the underlying type (so all format
+ * specifications of the underlying type are supported, e.g. "{:.3f}" or "{:10.2e}") followed by the unit. The
+ * unit is a compile time constant, see si::unitString.
+ * @tparam m the meter exponent
+ * @tparam kg the kilogram exponent
+ * @tparam s the second exponent
+ * @tparam A the Ampere exponent
+ * @tparam K the Kelvin exponent
+ * @tparam MOL the Mol exponent
+ * @tparam CD the Candela exponent
+ * @tparam T the underlying numerical type
+ */
+template<int m, int kg, int s, int A, int K, int MOL, int CD, typename T>
+struct std::formatter<si::Si<m, kg, s, A, K, MOL, CD, T>, char>
+        : std::formatter<typename si::ComputeType<T>::type, char> {
+    /**
+     * Format the value followed by the unit.
+     * @tparam FormatContext the type of the format context
+     * @param si the SI variable
+     * @param ctx the format context
+     * @return iterator behind the written characters
+     */
+    template<typename FormatContext>
+    auto format(const si::Si<m, kg, s, A, K, MOL, CD, T> &si, FormatContext &ctx) const {
+        using C = typename si::ComputeType<T>::type;
+        auto out = std::formatter<C, char>::format(static_cast<C>(si), ctx);
+        constexpr auto unit = si::unitString<m, kg, s, A, K, MOL, CD>.view();
+        return std::copy(unit.begin(), unit.end(), out);
+    }
+};
+#endif
+
+#endif
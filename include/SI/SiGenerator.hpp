@@ -141,7 +141,8 @@
     }
 
 /**
- * Macro to generate all definitions for a unit, i.e. a corresponding type, a constant and all literals.
+ * Macro to generate all definitions for a unit, i.e. a corresponding type, a constant and all literals, requires
+ * SiImpl.hpp.
  */
 #define SI_CREATE_UNIT(Name, name, m, kg, s, A, K, Mol, CD) /* NOLINT(cppcoreguidelines-macro-usage) */                \
     namespace si {                                                                                                     \
@@ -154,25 +155,56 @@
     }
 
 /**
- * Macro to generate the specialization of the unitToString function for a specific type.
+ * Macro to register a custom name for a unit which is used instead of the base units when printing and which can be
+ * parsed (see SiParser.hpp), requires SiUnitString.hpp. The macro specializes si::UnitName, so it needs to be visible
+ * in every translation unit which prints, formats or parses the unit (and before the first use), otherwise the program
+ * is ill-formed. Place it directly after the definition of the unit or in SiPrinterExtended.hpp, which is included by
+ * all of these headers.
  */
-#define SI_CUSTOM_PRINTER_IMPL(Type, name) /* NOLINT(cppcoreguidelines-macro-usage) */                                 \
+#define SI_CUSTOM_UNIT_NAME(Type, customName) /* NOLINT(cppcoreguidelines-macro-usage) */                              \
     namespace si {                                                                                                     \
         template<>                                                                                                     \
-        void unitToString<Type<>::meter, Type<>::kilogram, Type<>::second, Type<>::ampere, Type<>::kelvin,             \
-                          Type<>::mole, Type<>::candela>(std::ostream & ostream) {                                     \
-            ostream << " " << name;                                                                                    \
-        }                                                                                                              \
+        struct UnitName<Type<>::meter, Type<>::kilogram, Type<>::second, Type<>::ampere, Type<>::kelvin,               \
+                        Type<>::mole, Type<>::candela> {                                                               \
+            static constexpr std::string_view name{customName};                                                        \
+        };                                                                                                             \
     }
 
 /**
- * Macro to generate declaration of the the specialization of the unitToString function for a specific type.
+ * Macro to generate a single fixed point literal, the value is converted at compile time using integer arithmetic only
+ * (see SiFixed.hpp).
  */
-#define SI_CUSTOM_PRINTER_DEC(Type) /* NOLINT(cppcoreguidelines-macro-usage) */                                        \
+#define SI_CREATE_FIXED_LITERAL(Name, literal, exp) /* NOLINT(cppcoreguidelines-macro-usage) */                        \
+    template<char... chars>                                                                                            \
+    constexpr auto operator"" literal() -> Name<si::default_fixed_type> {                                              \
+        return Name<si::default_fixed_type>{si::detail::fixedLiteral<si::default_fixed_type, exp, chars...>()};        \
+    }
+
+/**
+ * Macro to generate fixed point literals for a unit with all prefixes from E to a in the namespace
+ * si::fixed_literals, requires SiFixed.hpp. The underlying type is si::default_fixed_type.
+ */
+#define SI_CREATE_FIXED_LITERALS(Name, name) /* NOLINT(cppcoreguidelines-macro-usage) */                               \
     namespace si {                                                                                                     \
-        template<>                                                                                                     \
-        void unitToString<Type<>::meter, Type<>::kilogram, Type<>::second, Type<>::ampere, Type<>::kelvin,             \
-                          Type<>::mole, Type<>::candela>(std::ostream & ostream);                                      \
+        namespace fixed_literals {                                                                                     \
+            SI_CREATE_FIXED_LITERAL(Name, _E_##name, 18)                                                               \
+            SI_CREATE_FIXED_LITERAL(Name, _P_##name, 15)                                                               \
+            SI_CREATE_FIXED_LITERAL(Name, _T_##name, 12)                                                               \
+            SI_CREATE_FIXED_LITERAL(Name, _G_##name, 9)                                                                \
+            SI_CREATE_FIXED_LITERAL(Name, _M_##name, 6)                                                                \
+            SI_CREATE_FIXED_LITERAL(Name, _k_##name, 3)                                                                \
+            SI_CREATE_FIXED_LITERAL(Name, _h_##name, 2)                                                                \
+            SI_CREATE_FIXED_LITERAL(Name, _da_##name, 1)                                                               \
+            SI_CREATE_FIXED_LITERAL(Name, _##name, 0)                                                                  \
+            SI_CREATE_FIXED_LITERAL(Name, _d_##name, -1)                                                               \
+            SI_CREATE_FIXED_LITERAL(Name, _c_##name, -2)                                                               \
+            SI_CREATE_FIXED_LITERAL(Name, _m_##name, -3)                                                               \
+            SI_CREATE_FIXED_LITERAL(Name, _mu_##name, -6)                                                              \
+            SI_CREATE_FIXED_LITERAL(Name, _n_##name, -9)                                                               \
+            SI_CREATE_FIXED_LITERAL(Name, _p_##name, -12)                                                              \
+            SI_CREATE_FIXED_LITERAL(Name, _f_##name, -15)                                                              \
+            SI_CREATE_FIXED_LITERAL(Name, _a_##name, -18)                                                              \
+        }                                                                                                              \
     }
 
 #endif
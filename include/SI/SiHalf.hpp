@@ -0,0 +1,337 @@
+/**
+ * @file SiHalf.hpp
+ * @author paul
+ * @date 17.10.26
+ * @brief 16 bit floating point types (half precision and bfloat16) as storage type of SI types, computations are
+ * performed in float. Requires C++20.
+ * @ingroup SI
+ */
+#ifndef SI_SIHALF_HPP
+#define SI_SIHALF_HPP
+
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+
+#if defined(__F16C__) || defined(__AVX512F__)
+    #include <immintrin.h>
+#endif
+
+#include "SiImpl.hpp"
+#include "SiSpan.hpp"
+
+#ifndef SI_NATIVE_HALF
+    #ifdef __FLT16_MAX__
+        #define SI_NATIVE_HALF 1 ///< Use the compiler type _Float16 for si::Half.
+    #else
+        #define SI_NATIVE_HALF 0 ///< Use the software implementation for si::Half.
+    #endif
+#endif
+
+namespace si {
+    namespace detail {
+        /**
+         * Conversion between float and IEEE 754 binary16 (half precision), rounds to nearest even.
+         */
+        struct HalfCodec {
+            /**
+             * Convert a float to half precision.
+             * @param val the value
+             * @return the bits of the nearest half precision value
+             */
+            static constexpr auto fromFloat(float val) noexcept -> std::uint16_t {
+#ifdef __F16C__
+                if (!std::is_constant_evaluated()) {
+                    return static_cast<std::uint16_t>(_cvtss_sh(val, _MM_FROUND_TO_NEAREST_INT));
+                }
+#endif
+                auto bits = std::bit_cast<std::uint32_t>(val);
+                auto sign = static_cast<std::uint16_t>((bits >> 16U) & 0x8000U);
+                bits &= 0x7FFFFFFFU;
+                if (bits >= 0x7F800000U) { // Inf and NaN, NaN stays quiet
+                    return static_cast<std::uint16_t>(sign | 0x7C00U | (bits > 0x7F800000U ? 0x0200U : 0U));
+                }
+                if (bits >= 0x477FF000U) { // Rounds to a value larger than 65504
+                    return static_cast<std::uint16_t>(sign | 0x7C00U);
+                }
+                if (bits < 0x38800000U) { // Subnormal half
+                    if (bits < 0x33000000U) {
+                        return sign;
+                    }
+                    auto exp = bits >> 23U;
+                    auto mantissa = (bits & 0x7FFFFFU) | 0x800000U;
+                    auto shift = 126U - exp;
+                    auto res = mantissa >> shift;
+                    auto rem = mantissa & ((1U << shift) - 1U);
+                    auto halfway = 1U << (shift - 1U);
+                    if (rem > halfway || (rem == halfway && (res & 1U) != 0)) {
+                        ++res;
+                    }
+                    return static_cast<std::uint16_t>(sign | res);
+                }
+                auto res = (bits - 0x38000000U) >> 13U; // Rebias the exponent from 127 to 15
+                auto rem = bits & 0x1FFFU;
+                if (rem > 0x1000U || (rem == 0x1000U && (res & 1U) != 0)) {
+                    ++res; // A carry into the exponent is correct
+                }
+                return static_cast<std::uint16_t>(sign | res);
+            }
+
+            /**
+             * Convert half precision to float, this is exact.
+             * @param bits the bits of the half precision value
+             * @return the value as float
+             */
+            static constexpr auto toFloat(std::uint16_t bits) noexcept -> float {
+#ifdef __F16C__
+                if (!std::is_constant_evaluated()) {
+                    return _cvtsh_ss(bits);
+                }
+#endif
+                auto sign = static_cast<std::uint32_t>(bits & 0x8000U) << 16U;
+                auto exp = static_cast<std::uint32_t>(bits >> 10U) & 0x1FU;
+                auto mantissa = static_cast<std::uint32_t>(bits) & 0x3FFU;
+                if (exp == 0x1FU) { // Inf and NaN
+                    return std::bit_cast<float>(sign | 0x7F800000U | (mantissa << 13U));
+                }
+                if (exp == 0) {
+                    if (mantissa == 0) {
+                        return std::bit_cast<float>(sign);
+                    }
+                    // Subnormal half, normalize the mantissa
+                    exp = 127 - 15 + 1;
+                    while ((mantissa & 0x400U) == 0) {
+                        mantissa <<= 1U;
+                        --exp;
+                    }
+                    return std::bit_cast<float>(sign | (exp << 23U) | ((mantissa & 0x3FFU) << 13U));
+                }
+                return std::bit_cast<float>(sign | ((exp + 127 - 15) << 23U) | (mantissa << 13U));
+            }
+        };
+
+        /**
+         * Conversion between float and bfloat16 (the upper 16 bits of a float), rounds to nearest even.
+         */
+        struct BFloat16Codec {
+            /**
+             * Convert a float to bfloat16.
+             * @param val the value
+             * @return the bits of the nearest bfloat16 value
+             */
+            static constexpr auto fromFloat(float val) noexcept -> std::uint16_t {
+                auto bits = std::bit_cast<std::uint32_t>(val);
+                if ((bits & 0x7FFFFFFFU) > 0x7F800000U) { // NaN, keep it quiet
+                    return static_cast<std::uint16_t>((bits >> 16U) | 0x0040U);
+                }
+                bits += 0x7FFFU + ((bits >> 16U) & 1U);
+                return static_cast<std::uint16_t>(bits >> 16U);
+            }
+
+            /**
+             * Convert bfloat16 to float, this is exact.
+             * @param bits the bits of the bfloat16 value
+             * @return the value as float
+             */
+            static constexpr auto toFloat(std::uint16_t bits) noexcept -> float {
+                return std::bit_cast<float>(static_cast<std::uint32_t>(bits) << 16U);
+            }
+        };
+
+        /**
+         * 16 bit floating point number which is only used for storage: it converts implicitly from and to float
+         * (like the builtin floating point types) so all arithmetic is performed in float.
+         * @tparam Codec the conversion between float and the 16 bit representation
+         */
+        template<typename Codec>
+        class Float16 {
+          public:
+            constexpr Float16() noexcept = default;
+
+            /**
+             * Create a value by rounding a float to the nearest representable value.
+             * @param val the value
+             */
+            constexpr Float16(float val) noexcept /* NOLINT(google-explicit-constructor) */ :
+                bits_{Codec::fromFloat(val)} {
+            }
+
+            /**
+             * Create a value from its binary representation.
+             * @param bits the binary representation
+             * @return the value
+             */
+            static constexpr auto fromBits(std::uint16_t bits) noexcept -> Float16 {
+                Float16 res;
+                res.bits_ = bits;
+                return res;
+            }
+
+            /**
+             * Binary representation of the value.
+             * @return the bits
+             */
+            [[nodiscard]] constexpr auto bits() const noexcept -> std::uint16_t {
+                return bits_;
+            }
+
+            /**
+             * Conversion to float, this is exact.
+             * @return the value as float
+             */
+            constexpr operator float() const noexcept /* NOLINT(google-explicit-constructor) */ {
+                return Codec::toFloat(bits_);
+            }
+
+            /**
+             * Add a value, the sum is calculated in float.
+             * @param rhs the value to add
+             * @return this value
+             */
+            constexpr auto operator+=(Float16 rhs) noexcept -> Float16 & {
+                return *this = Float16{static_cast<float>(*this) + static_cast<float>(rhs)};
+            }
+
+            /**
+             * Subtract a value, the difference is calculated in float.
+             * @param rhs the value to subtract
+             * @return this value
+             */
+            constexpr auto operator-=(Float16 rhs) noexcept -> Float16 & {
+                return *this = Float16{static_cast<float>(*this) - static_cast<float>(rhs)};
+            }
+
+            /**
+             * Multiply by a value, the product is calculated in float.
+             * @param rhs the factor
+             * @return this value
+             */
+            constexpr auto operator*=(Float16 rhs) noexcept -> Float16 & {
+                return *this = Float16{static_cast<float>(*this) * static_cast<float>(rhs)};
+            }
+
+            /**
+             * Divide by a value, the quotient is calculated in float.
+             * @param rhs the divisor
+             * @return this value
+             */
+            constexpr auto operator/=(Float16 rhs) noexcept -> Float16 & {
+                return *this = Float16{static_cast<float>(*this) / static_cast<float>(rhs)};
+            }
+
+          private:
+            std::uint16_t bits_{};
+        };
+    } // namespace detail
+
+#if SI_NATIVE_HALF
+    /**
+     * IEEE 754 half precision floating point type, the compiler type _Float16 (i.e. std::float16_t) if available.
+     */
+    using Half = _Float16;
+#else
+    /**
+     * IEEE 754 half precision floating point type, the compiler type _Float16 (i.e. std::float16_t) if available.
+     */
+    using Half = detail::Float16<detail::HalfCodec>;
+#endif
+
+    /**
+     * Brain floating point type: same range as float but only 8 bits of precision.
+     */
+    using BFloat16 = detail::Float16<detail::BFloat16Codec>;
+
+    /**
+     * Half precision values are computed in float.
+     */
+    template<>
+    struct ComputeType<Half> {
+        using type = float; ///< Type used for computations
+    };
+
+    /**
+     * Bfloat16 values are computed in float.
+     */
+    template<>
+    struct ComputeType<BFloat16> {
+        using type = float; ///< Type used for computations
+    };
+
+    static_assert(hasRawLayout<Si<0, 0, 0, 0, 0, 0, 0, Half>>, "SI has a different layout than Half");
+    static_assert(hasRawLayout<Si<0, 0, 0, 0, 0, 0, 0, BFloat16>>, "SI has a different layout than BFloat16");
+
+#if defined(__F16C__) || defined(__AVX512F__)
+    namespace detail {
+        /**
+         * Conversion of half precision values to float using the F16C (8 values) or AVX-512 (16 values)
+         * instructions.
+         */
+        template<>
+        struct BulkConversion<Half, float> {
+            /**
+             * Convert all values.
+             * @param in the values to convert
+             * @param out the converted values
+             * @param size the number of values
+             */
+            static void convert(const Half *in, float *out, std::size_t size) noexcept {
+                std::size_t i = 0;
+                // NOLINTBEGIN(cppcoreguidelines-pro-type-reinterpret-cast) unaligned loads and stores
+    #ifdef __AVX512F__
+                for (; i + 16 <= size; i += 16) {
+                    auto half = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(in + i));
+                    _mm512_storeu_ps(out + i, _mm512_maskz_cvtph_ps(0xFFFF, half));
+                }
+    #endif
+    #ifdef __F16C__
+                for (; i + 8 <= size; i += 8) {
+                    auto half = _mm_loadu_si128(reinterpret_cast<const __m128i *>(in + i));
+                    _mm256_storeu_ps(out + i, _mm256_cvtph_ps(half));
+                }
+    #endif
+                // NOLINTEND(cppcoreguidelines-pro-type-reinterpret-cast)
+                for (; i < size; ++i) {
+                    out[i] = static_cast<float>(in[i]);
+                }
+            }
+        };
+
+        /**
+         * Conversion of float values to half precision using the F16C (8 values) or AVX-512 (16 values)
+         * instructions, rounds to nearest even.
+         */
+        template<>
+        struct BulkConversion<float, Half> {
+            /**
+             * Convert all values.
+             * @param in the values to convert
+             * @param out the converted values
+             * @param size the number of values
+             */
+            static void convert(const float *in, Half *out, std::size_t size) noexcept {
+                std::size_t i = 0;
+                // NOLINTBEGIN(cppcoreguidelines-pro-type-reinterpret-cast) unaligned loads and stores
+    #ifdef __AVX512F__
+                for (; i + 16 <= size; i += 16) {
+                    auto half = _mm512_maskz_cvtps_ph(0xFFFF, _mm512_loadu_ps(in + i), _MM_FROUND_TO_NEAREST_INT);
+                    _mm256_storeu_si256(reinterpret_cast<__m256i *>(out + i), half);
+                }
+    #endif
+    #ifdef __F16C__
+                for (; i + 8 <= size; i += 8) {
+                    auto half = _mm256_cvtps_ph(_mm256_loadu_ps(in + i), _MM_FROUND_TO_NEAREST_INT);
+                    _mm_storeu_si128(reinterpret_cast<__m128i *>(out + i), half);
+                }
+    #endif
+                // NOLINTEND(cppcoreguidelines-pro-type-reinterpret-cast)
+                for (; i < size; ++i) {
+                    out[i] = static_cast<Half>(in[i]);
+                }
+            }
+        };
+    } // namespace detail
+#endif
+} // namespace si
+
+#endif
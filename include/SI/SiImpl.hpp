@@ -9,6 +9,7 @@
 #ifndef SI_SIIMPL_HPP
 #define SI_SIIMPL_HPP
 
+#include <type_traits>
 #include <utility>
 
 #if __cpp_conditional_explicit
@@ -41,6 +42,16 @@ namespace si {
         static constexpr auto val = false;
     };
 
+    /**
+     * Type trait for the type used for computations with values of type T (STL functions and printing), storage
+     * only types (e.g. half precision floats, see SiHalf.hpp) specialize this trait to compute in a wider type.
+     * @tparam T the underlying numerical type
+     */
+    template<typename T>
+    struct ComputeType {
+        using type = T; ///< Type used for computations
+    };
+
     /**
      * Class to represent a number with unit.
      * @tparam m the meter exponent
@@ -124,6 +135,27 @@ namespace si {
          */
         constexpr void operator+=(ThisT rhs);
 
+        /**
+         * Add object with SI object of same unit but different type, the sum is calculated using the promoted type
+         * std::common_type_t<T, T_>.
+         * @tparam T_ the underlying type of the other object
+         * @param rhs the object to add
+         * @return the sum of both values with same unit and promoted type
+         */
+        template<typename T_, std::enable_if_t<!std::is_same_v<T, T_>, bool> = true>
+        constexpr auto operator+(Si<m, kg, s, A, K, MOL, CD, T_> rhs) const
+                -> Si<m, kg, s, A, K, MOL, CD, std::common_type_t<T, T_>>;
+
+        /**
+         * Increment object by SI object of same unit but different type, only available if T is the promoted type
+         * (i.e. accumulating into a wider type), narrowing requires an explicit conversion.
+         * @tparam T_ the underlying type of the other object
+         * @param rhs the object to add
+         */
+        template<typename T_, std::enable_if_t<!std::is_same_v<T, T_> && std::is_same_v<std::common_type_t<T, T_>, T>,
+                                               bool> = true>
+        constexpr void operator+=(Si<m, kg, s, A, K, MOL, CD, T_> rhs);
+
         /**
          * Subtract object with SI object of same unit and type
          * @param rhs the object to subtract
@@ -138,6 +170,27 @@ namespace si {
          */
         constexpr void operator-=(ThisT rhs);
 
+        /**
+         * Subtract SI object of same unit but different type, the difference is calculated using the promoted type
+         * std::common_type_t<T, T_>.
+         * @tparam T_ the underlying type of the other object
+         * @param rhs the object to subtract
+         * @return the difference of both values with same unit and promoted type
+         */
+        template<typename T_, std::enable_if_t<!std::is_same_v<T, T_>, bool> = true>
+        constexpr auto operator-(Si<m, kg, s, A, K, MOL, CD, T_> rhs) const
+                -> Si<m, kg, s, A, K, MOL, CD, std::common_type_t<T, T_>>;
+
+        /**
+         * Decrement object by SI object of same unit but different type, only available if T is the promoted type
+         * (i.e. accumulating into a wider type), narrowing requires an explicit conversion.
+         * @tparam T_ the underlying type of the other object
+         * @param rhs the object to subtract
+         */
+        template<typename T_, std::enable_if_t<!std::is_same_v<T, T_> && std::is_same_v<std::common_type_t<T, T_>, T>,
+                                               bool> = true>
+        constexpr void operator-=(Si<m, kg, s, A, K, MOL, CD, T_> rhs);
+
         /**
          * Unary minus, apply unary minus to value and keep unit.
          * @return the negative of the current object.
@@ -209,7 +262,8 @@ namespace si {
                 -> Si<-m_, -kg_, -s_, -A_, -K_, -MOL_, -CD_, T_>;
 
         /**
-         * Calculate the product of two SI variables by summing the unit-exponents and multiplying the values.
+         * Calculate the product of two SI variables by summing the unit-exponents and multiplying the values. If the
+         * underlying types differ the product is calculated using the promoted type std::common_type_t<T, T_>.
          * @tparam m_ the other meter exponent
          * @tparam kg_ the other kilogram exponent
          * @tparam s_ the other second exponent
@@ -217,16 +271,18 @@ namespace si {
          * @tparam K_ the other Kelvin exponent
          * @tparam MOL_ the other Mol exponent
          * @tparam CD_ the other Candela exponent
+         * @tparam T_ the other underlying numerical type
          * @param rhs the other SI variable
          * @return the product of the SI variables
          */
-        template<int m_, int kg_, int s_, int A_, int K_, int MOL_, int CD_>
-        constexpr auto operator*(Si<m_, kg_, s_, A_, K_, MOL_, CD_, T> rhs) const
-                -> Si<m + m_, kg + kg_, s + s_, A + A_, K + K_, MOL + MOL_, CD + CD_, T>;
+        template<int m_, int kg_, int s_, int A_, int K_, int MOL_, int CD_, typename T_>
+        constexpr auto operator*(Si<m_, kg_, s_, A_, K_, MOL_, CD_, T_> rhs) const
+                -> Si<m + m_, kg + kg_, s + s_, A + A_, K + K_, MOL + MOL_, CD + CD_, std::common_type_t<T, T_>>;
 
         /**
          * Calculate the division of two SI variables by taking the difference of the unit-exponents and dividing
-         * the values.
+         * the values. If the underlying types differ the quotient is calculated using the promoted type
+         * std::common_type_t<T, T_>.
          * @tparam m_ the other meter exponent
          * @tparam kg_ the other kilogram exponent
          * @tparam s_ the other second exponent
@@ -234,12 +290,13 @@ namespace si {
          * @tparam K_ the other Kelvin exponent
          * @tparam MOL_ the other Mol exponent
          * @tparam CD_ the other Candela exponent
+         * @tparam T_ the other underlying numerical type
          * @param rhs the SI variable by which to divide
          * @return the division of the SI variables
          */
-        template<int m_, int kg_, int s_, int A_, int K_, int MOL_, int CD_>
-        constexpr auto operator/(Si<m_, kg_, s_, A_, K_, MOL_, CD_, T> rhs) const
-                -> Si<m - m_, kg - kg_, s - s_, A - A_, K - K_, MOL - MOL_, CD - CD_, T>;
+        template<int m_, int kg_, int s_, int A_, int K_, int MOL_, int CD_, typename T_>
+        constexpr auto operator/(Si<m_, kg_, s_, A_, K_, MOL_, CD_, T_> rhs) const
+                -> Si<m - m_, kg - kg_, s - s_, A - A_, K - K_, MOL - MOL_, CD - CD_, std::common_type_t<T, T_>>;
 
 
 #ifndef __cpp_impl_three_way_comparison
@@ -256,7 +313,26 @@ namespace si {
          * @return true if the values are not equal, otherwise false
          */
         constexpr auto operator!=(ThisT rhs) const;
+#else
+        /**
+         * Three way comparison operator (i.e <,>,<=,>=,== and !=) for SI types. Requires same unit, then performs
+         * comparison by value.
+         * @param rhs the other value
+         * @return 0 if equal, 1 if this is greater than rhs, -1 if this is less than rhs
+         */
+        constexpr auto operator<=>(const ThisT &rhs) const = default;
+
+        /**
+         * Equality operator for SI types, needs to be defaulted explicitly as the overload for different types
+         * prevents the implicit declaration.
+         * @param rhs the other value
+         * @return true if the values are equal, otherwise false
+         */
+        constexpr auto operator==(const ThisT &rhs) const -> bool = default;
+#endif
 
+        // The relational operators are declared explicitly even if operator<=> is available, the rewritten
+        // expression (a <=> b) < 0 results in additional instructions for floating point types.
         /**
          * Less than operator for SI types. Requires same unit, then performs comparison by value.
          * @param rhs the other value
@@ -284,15 +360,66 @@ namespace si {
          * @return true if this is greater or equal than rhs
          */
         constexpr auto operator>=(ThisT rhs) const -> bool;
-#else
+
         /**
-         * Three way comparison operator (i.e <,>,<=,>=,== and !=) for SI types. Requires same unit, then performs
-         * comparison by value.
+         * Equality operator for SI types of same unit but different type, the values are compared using
+         * the promoted type std::common_type_t<T, T_>.
+         * @tparam T_ the underlying type of the other object
          * @param rhs the other value
-         * @return 0 if equal, 1 if this is greater than rhs, -1 if this is less than rhs
+         * @return true if the values are equal
          */
-        constexpr auto operator<=>(const ThisT &rhs) const = default;
-#endif
+        template<typename T_, std::enable_if_t<!std::is_same_v<T, T_>, bool> = true>
+        constexpr auto operator==(Si<m, kg, s, A, K, MOL, CD, T_> rhs) const -> bool;
+
+        /**
+         * Non-Equality operator for SI types of same unit but different type, the values are compared using
+         * the promoted type std::common_type_t<T, T_>.
+         * @tparam T_ the underlying type of the other object
+         * @param rhs the other value
+         * @return true if the values are not equal
+         */
+        template<typename T_, std::enable_if_t<!std::is_same_v<T, T_>, bool> = true>
+        constexpr auto operator!=(Si<m, kg, s, A, K, MOL, CD, T_> rhs) const -> bool;
+
+        /**
+         * Less than operator for SI types of same unit but different type, the values are compared using
+         * the promoted type std::common_type_t<T, T_>.
+         * @tparam T_ the underlying type of the other object
+         * @param rhs the other value
+         * @return true if this is less than rhs
+         */
+        template<typename T_, std::enable_if_t<!std::is_same_v<T, T_>, bool> = true>
+        constexpr auto operator<(Si<m, kg, s, A, K, MOL, CD, T_> rhs) const -> bool;
+
+        /**
+         * Greater than operator for SI types of same unit but different type, the values are compared using
+         * the promoted type std::common_type_t<T, T_>.
+         * @tparam T_ the underlying type of the other object
+         * @param rhs the other value
+         * @return true if this is greater than rhs
+         */
+        template<typename T_, std::enable_if_t<!std::is_same_v<T, T_>, bool> = true>
+        constexpr auto operator>(Si<m, kg, s, A, K, MOL, CD, T_> rhs) const -> bool;
+
+        /**
+         * Less than-equal operator for SI types of same unit but different type, the values are compared using
+         * the promoted type std::common_type_t<T, T_>.
+         * @tparam T_ the underlying type of the other object
+         * @param rhs the other value
+         * @return true if this is less or equal than rhs
+         */
+        template<typename T_, std::enable_if_t<!std::is_same_v<T, T_>, bool> = true>
+        constexpr auto operator<=(Si<m, kg, s, A, K, MOL, CD, T_> rhs) const -> bool;
+
+        /**
+         * Greater than-equal operator for SI types of same unit but different type, the values are compared using
+         * the promoted type std::common_type_t<T, T_>.
+         * @tparam T_ the underlying type of the other object
+         * @param rhs the other value
+         * @return true if this is greater or equal than rhs
+         */
+        template<typename T_, std::enable_if_t<!std::is_same_v<T, T_>, bool> = true>
+        constexpr auto operator>=(Si<m, kg, s, A, K, MOL, CD, T_> rhs) const -> bool;
 
       private:
         T val;
@@ -317,6 +444,38 @@ namespace si {
         static constexpr auto val = true;
     };
 
+    namespace detail {
+        /**
+         * SI type with the same unit but another underlying type.
+         */
+        template<typename SiT, typename T>
+        struct Rebind;
+
+        /**
+         * Specialization of Rebind for SI types.
+         */
+        template<int m, int kg, int s, int A, int K, int MOL, int CD, typename T_, typename T>
+        struct Rebind<Si<m, kg, s, A, K, MOL, CD, T_>, T> {
+            using type = Si<m, kg, s, A, K, MOL, CD, T>; ///< The SI type with underlying type T
+        };
+    } // namespace detail
+
+    /**
+     * Checks whether an SI type has exactly the same memory layout as its underlying type, this is the case if the
+     * underlying type is trivially copyable. The layout guarantee allows to reinterpret memory of SI values as memory
+     * of the underlying type and vice versa (see SiSpan.hpp).
+     * @tparam SiT the SI type to check
+     */
+    template<typename SiT>
+    constexpr auto hasRawLayout = std::is_standard_layout_v<SiT> && std::is_trivially_copyable_v<SiT> &&
+                                  sizeof(SiT) == sizeof(typename SiT::type) &&
+                                  alignof(SiT) == alignof(typename SiT::type);
+
+    static_assert(hasRawLayout<Si<0, 0, 0, 0, 0, 0, 0, default_type>>, "SI has a different layout than default_type");
+    static_assert(hasRawLayout<Si<0, 0, 0, 0, 0, 0, 0, float>>, "SI has a different layout than float");
+    static_assert(hasRawLayout<Si<0, 0, 0, 0, 0, 0, 0, double>>, "SI has a different layout than double");
+    static_assert(hasRawLayout<Si<0, 0, 0, 0, 0, 0, 0, int>>, "SI has a different layout than int");
+
     // CTor, Conversion
     template<int m, int kg, int s, int A, int K, int MOL, int CD, typename T>
     template<typename T_>
@@ -341,6 +500,22 @@ namespace si {
         this->val += rhs.val;
     }
 
+    // Add with different type
+    template<int m, int kg, int s, int A, int K, int MOL, int CD, typename T>
+    template<typename T_, std::enable_if_t<!std::is_same_v<T, T_>, bool>>
+    constexpr auto Si<m, kg, s, A, K, MOL, CD, T>::operator+(Si<m, kg, s, A, K, MOL, CD, T_> rhs) const
+            -> Si<m, kg, s, A, K, MOL, CD, std::common_type_t<T, T_>> {
+        using R = std::common_type_t<T, T_>;
+        return Si<m, kg, s, A, K, MOL, CD, R>{static_cast<R>(this->val) + static_cast<R>(rhs)};
+    }
+
+    template<int m, int kg, int s, int A, int K, int MOL, int CD, typename T>
+    template<typename T_,
+             std::enable_if_t<!std::is_same_v<T, T_> && std::is_same_v<std::common_type_t<T, T_>, T>, bool>>
+    constexpr void Si<m, kg, s, A, K, MOL, CD, T>::operator+=(Si<m, kg, s, A, K, MOL, CD, T_> rhs) {
+        this->val += static_cast<T>(rhs);
+    }
+
     // Subtract
     template<int m, int kg, int s, int A, int K, int MOL, int CD, typename T>
     constexpr auto Si<m, kg, s, A, K, MOL, CD, T>::operator-(Si::ThisT rhs) const -> Si::ThisT {
@@ -352,6 +527,22 @@ namespace si {
         this->val -= rhs.val;
     }
 
+    // Subtract with different type
+    template<int m, int kg, int s, int A, int K, int MOL, int CD, typename T>
+    template<typename T_, std::enable_if_t<!std::is_same_v<T, T_>, bool>>
+    constexpr auto Si<m, kg, s, A, K, MOL, CD, T>::operator-(Si<m, kg, s, A, K, MOL, CD, T_> rhs) const
+            -> Si<m, kg, s, A, K, MOL, CD, std::common_type_t<T, T_>> {
+        using R = std::common_type_t<T, T_>;
+        return Si<m, kg, s, A, K, MOL, CD, R>{static_cast<R>(this->val) - static_cast<R>(rhs)};
+    }
+
+    template<int m, int kg, int s, int A, int K, int MOL, int CD, typename T>
+    template<typename T_,
+             std::enable_if_t<!std::is_same_v<T, T_> && std::is_same_v<std::common_type_t<T, T_>, T>, bool>>
+    constexpr void Si<m, kg, s, A, K, MOL, CD, T>::operator-=(Si<m, kg, s, A, K, MOL, CD, T_> rhs) {
+        this->val -= static_cast<T>(rhs);
+    }
+
     // Unary minus
     template<int m, int kg, int s, int A, int K, int MOL, int CD, typename T>
     constexpr auto Si<m, kg, s, A, K, MOL, CD, T>::operator-() const -> Si::ThisT {
@@ -361,7 +552,7 @@ namespace si {
     // Multiply by scalar
     template<int m, int kg, int s, int A, int K, int MOL, int CD, typename T>
     constexpr auto Si<m, kg, s, A, K, MOL, CD, T>::operator*(T rhs) const -> ThisT {
-        return Si<m, kg, s, A, K, MOL, CD, decltype(this->val * rhs)>{this->val * rhs};
+        return ThisT{static_cast<T>(this->val * rhs)};
     }
 
     template<int m, int kg, int s, int A, int K, int MOL, int CD, typename T>
@@ -392,7 +583,7 @@ namespace si {
     // Divide by scalar
     template<int m, int kg, int s, int A, int K, int MOL, int CD, typename T>
     constexpr auto Si<m, kg, s, A, K, MOL, CD, T>::operator/(T rhs) const -> Si<m, kg, s, A, K, MOL, CD, T> {
-        return Si<m, kg, s, A, K, MOL, CD, decltype(this->val * rhs)>{this->val / rhs};
+        return ThisT{static_cast<T>(this->val / rhs)};
     }
 
     template<int m, int kg, int s, int A, int K, int MOL, int CD, typename T>
@@ -422,18 +613,22 @@ namespace si {
 
     // Multiply with different type
     template<int m, int kg, int s, int A, int K, int MOL, int CD, typename T>
-    template<int m_, int kg_, int s_, int A_, int K_, int MOL_, int CD_>
-    constexpr auto Si<m, kg, s, A, K, MOL, CD, T>::operator*(Si<m_, kg_, s_, A_, K_, MOL_, CD_, T> rhs) const
-            -> Si<m + m_, kg + kg_, s + s_, A + A_, K + K_, MOL + MOL_, CD + CD_, T> {
-        return Si<m + m_, kg + kg_, s + s_, A + A_, K + K_, MOL + MOL_, CD + CD_, T>{this->val * static_cast<T>(rhs)};
+    template<int m_, int kg_, int s_, int A_, int K_, int MOL_, int CD_, typename T_>
+    constexpr auto Si<m, kg, s, A, K, MOL, CD, T>::operator*(Si<m_, kg_, s_, A_, K_, MOL_, CD_, T_> rhs) const
+            -> Si<m + m_, kg + kg_, s + s_, A + A_, K + K_, MOL + MOL_, CD + CD_, std::common_type_t<T, T_>> {
+        using R = std::common_type_t<T, T_>;
+        return Si<m + m_, kg + kg_, s + s_, A + A_, K + K_, MOL + MOL_, CD + CD_, R>{static_cast<R>(this->val) *
+                                                                                     static_cast<R>(rhs)};
     }
 
     // Divide by different type
     template<int m, int kg, int s, int A, int K, int MOL, int CD, typename T>
-    template<int m_, int kg_, int s_, int A_, int K_, int MOL_, int CD_>
-    constexpr auto Si<m, kg, s, A, K, MOL, CD, T>::operator/(Si<m_, kg_, s_, A_, K_, MOL_, CD_, T> rhs) const
-            -> Si<m - m_, kg - kg_, s - s_, A - A_, K - K_, MOL - MOL_, CD - CD_, T> {
-        return Si<m - m_, kg - kg_, s - s_, A - A_, K - K_, MOL - MOL_, CD - CD_, T>{this->val / static_cast<T>(rhs)};
+    template<int m_, int kg_, int s_, int A_, int K_, int MOL_, int CD_, typename T_>
+    constexpr auto Si<m, kg, s, A, K, MOL, CD, T>::operator/(Si<m_, kg_, s_, A_, K_, MOL_, CD_, T_> rhs) const
+            -> Si<m - m_, kg - kg_, s - s_, A - A_, K - K_, MOL - MOL_, CD - CD_, std::common_type_t<T, T_>> {
+        using R = std::common_type_t<T, T_>;
+        return Si<m - m_, kg - kg_, s - s_, A - A_, K - K_, MOL - MOL_, CD - CD_, R>{static_cast<R>(this->val) /
+                                                                                     static_cast<R>(rhs)};
     }
 
 
@@ -447,6 +642,7 @@ namespace si {
     constexpr auto Si<m, kg, s, A, K, MOL, CD, T>::operator!=(Si::ThisT rhs) const {
         return !((*this) == rhs);
     }
+#endif
 
     // Size comparison
     template<int m, int kg, int s, int A, int K, int MOL, int CD, typename T>
@@ -468,7 +664,49 @@ namespace si {
     constexpr auto Si<m, kg, s, A, K, MOL, CD, T>::operator>=(Si::ThisT rhs) const -> bool {
         return this->val >= static_cast<T>(rhs);
     }
-#endif
+
+    // Comparison with different type
+    template<int m, int kg, int s, int A, int K, int MOL, int CD, typename T>
+    template<typename T_, std::enable_if_t<!std::is_same_v<T, T_>, bool>>
+    constexpr auto Si<m, kg, s, A, K, MOL, CD, T>::operator==(Si<m, kg, s, A, K, MOL, CD, T_> rhs) const -> bool {
+        using R = std::common_type_t<T, T_>;
+        return static_cast<R>(this->val) == static_cast<R>(rhs);
+    }
+
+    template<int m, int kg, int s, int A, int K, int MOL, int CD, typename T>
+    template<typename T_, std::enable_if_t<!std::is_same_v<T, T_>, bool>>
+    constexpr auto Si<m, kg, s, A, K, MOL, CD, T>::operator!=(Si<m, kg, s, A, K, MOL, CD, T_> rhs) const -> bool {
+        using R = std::common_type_t<T, T_>;
+        return static_cast<R>(this->val) != static_cast<R>(rhs);
+    }
+
+    template<int m, int kg, int s, int A, int K, int MOL, int CD, typename T>
+    template<typename T_, std::enable_if_t<!std::is_same_v<T, T_>, bool>>
+    constexpr auto Si<m, kg, s, A, K, MOL, CD, T>::operator<(Si<m, kg, s, A, K, MOL, CD, T_> rhs) const -> bool {
+        using R = std::common_type_t<T, T_>;
+        return static_cast<R>(this->val) < static_cast<R>(rhs);
+    }
+
+    template<int m, int kg, int s, int A, int K, int MOL, int CD, typename T>
+    template<typename T_, std::enable_if_t<!std::is_same_v<T, T_>, bool>>
+    constexpr auto Si<m, kg, s, A, K, MOL, CD, T>::operator>(Si<m, kg, s, A, K, MOL, CD, T_> rhs) const -> bool {
+        using R = std::common_type_t<T, T_>;
+        return static_cast<R>(this->val) > static_cast<R>(rhs);
+    }
+
+    template<int m, int kg, int s, int A, int K, int MOL, int CD, typename T>
+    template<typename T_, std::enable_if_t<!std::is_same_v<T, T_>, bool>>
+    constexpr auto Si<m, kg, s, A, K, MOL, CD, T>::operator<=(Si<m, kg, s, A, K, MOL, CD, T_> rhs) const -> bool {
+        using R = std::common_type_t<T, T_>;
+        return static_cast<R>(this->val) <= static_cast<R>(rhs);
+    }
+
+    template<int m, int kg, int s, int A, int K, int MOL, int CD, typename T>
+    template<typename T_, std::enable_if_t<!std::is_same_v<T, T_>, bool>>
+    constexpr auto Si<m, kg, s, A, K, MOL, CD, T>::operator>=(Si<m, kg, s, A, K, MOL, CD, T_> rhs) const -> bool {
+        using R = std::common_type_t<T, T_>;
+        return static_cast<R>(this->val) >= static_cast<R>(rhs);
+    }
 
 } // namespace si
 
@@ -0,0 +1,473 @@
+/**
+ * @file SiLut.hpp
+ * @author paul
+ * @date 17.10.26
+ * @brief Lookup tables on a uniform grid with linear and cubic interpolation (e.g. for calibration curves), the units
+ * of the input and output are checked. Requires C++20.
+ * @ingroup SI
+ */
+#ifndef SI_SILUT_HPP
+#define SI_SILUT_HPP
+
+#include <array>
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <span>
+#include <type_traits>
+
+#include "SiImpl.hpp"
+#include "SiSpan.hpp"
+#include "SiStlBatch.hpp"
+
+namespace si {
+    namespace detail {
+        /**
+         * AVX2 kernels for the batch evaluation of lookup tables, the indices are calculated per lane and the samples
+         * are loaded using gather instructions. The kernels only process complete registers and return the number of
+         * processed values, the remaining values are evaluated by the caller.
+         * @tparam T the underlying type, only double and float are supported
+         */
+        template<typename T>
+        struct LutAvx2 {
+            static constexpr bool available = false; ///< No kernels for this type
+        };
+
+#if SI_STL_BATCH_AVX2
+        /**
+         * AVX2 lookup table kernels for double.
+         */
+        template<>
+        struct LutAvx2<double> {
+            static constexpr bool available = true; ///< Kernels are available
+            static constexpr std::size_t lanes = 4; ///< Values per register
+
+            /**
+             * Load the values at four indices (the masked variant avoids a false uninitialized warning of GCC).
+             * @param values the base address
+             * @param idx the indices
+             * @return the values
+             */
+            SI_TARGET_AVX2 static auto gather(const double *values, __m128i idx) noexcept -> __m256d {
+                auto all = _mm256_castsi256_pd(_mm256_set1_epi64x(-1));
+                return _mm256_mask_i32gather_pd(_mm256_setzero_pd(), values, idx, all, sizeof(double));
+            }
+
+            /**
+             * Clamped position and index of the lower sample of four lanes.
+             * @param x the inputs
+             * @param min the input of the first sample
+             * @param invStep the reciprocal of the distance between two samples
+             * @param last the index of the last sample
+             * @param maxIdx the largest index of the lower sample
+             * @param idx set to the index of the lower sample
+             * @return the distance to the lower sample in units of samples
+             */
+            SI_TARGET_AVX2 static auto fraction(__m256d x, double min, double invStep, std::int32_t last,
+                                                std::int32_t maxIdx, __m128i &idx) noexcept -> __m256d {
+                auto pos = _mm256_mul_pd(_mm256_sub_pd(x, _mm256_set1_pd(min)), _mm256_set1_pd(invStep));
+                pos = _mm256_max_pd(pos, _mm256_setzero_pd()); // The second operand is returned for NaN
+                pos = _mm256_min_pd(pos, _mm256_set1_pd(static_cast<double>(last)));
+                idx = _mm_min_epi32(_mm256_cvttpd_epi32(pos), _mm_set1_epi32(maxIdx));
+                return _mm256_sub_pd(pos, _mm256_cvtepi32_pd(idx));
+            }
+
+            /**
+             * Linear interpolation.
+             * @param in the inputs
+             * @param out the outputs
+             * @param size the number of values
+             * @param values the samples
+             * @param last the index of the last sample
+             * @param min the input of the first sample
+             * @param invStep the reciprocal of the distance between two samples
+             * @return the number of processed values
+             */
+            SI_TARGET_AVX2 static auto linear(const double *in, double *out, std::size_t size, const double *values,
+                                              std::int32_t last, double min, double invStep) noexcept
+                    -> std::size_t {
+                std::size_t i = 0;
+                for (; i + lanes <= size; i += lanes) {
+                    __m128i idx;
+                    auto frac = fraction(_mm256_loadu_pd(in + i), min, invStep, last, last - 1, idx);
+                    auto lower = gather(values, idx);
+                    auto upper = gather(values + 1, idx);
+                    _mm256_storeu_pd(out + i, _mm256_add_pd(lower, _mm256_mul_pd(frac, _mm256_sub_pd(upper, lower))));
+                }
+                return i;
+            }
+
+            /**
+             * Cubic interpolation (Catmull-Rom spline).
+             * @param in the inputs
+             * @param out the outputs
+             * @param size the number of values
+             * @param values the samples
+             * @param last the index of the last sample
+             * @param min the input of the first sample
+             * @param invStep the reciprocal of the distance between two samples
+             * @return the number of processed values
+             */
+            SI_TARGET_AVX2 static auto cubic(const double *in, double *out, std::size_t size, const double *values,
+                                             std::int32_t last, double min, double invStep) noexcept -> std::size_t {
+                const auto two = _mm256_set1_pd(2.0);
+                std::size_t i = 0;
+                for (; i + lanes <= size; i += lanes) {
+                    __m128i idx;
+                    auto frac = fraction(_mm256_loadu_pd(in + i), min, invStep, last, last - 1, idx);
+                    auto p1 = gather(values, idx);
+                    auto p2 = gather(values + 1, idx);
+                    auto prev = _mm_max_epi32(_mm_sub_epi32(idx, _mm_set1_epi32(1)), _mm_setzero_si128());
+                    auto next = _mm_min_epi32(_mm_add_epi32(idx, _mm_set1_epi32(2)), _mm_set1_epi32(last));
+                    auto p0 = gather(values, prev);
+                    auto p3 = gather(values, next);
+                    // At the borders the missing sample is extrapolated linearly
+                    auto first = _mm256_cvtepi32_epi64(_mm_cmpeq_epi32(idx, _mm_setzero_si128()));
+                    auto end = _mm256_cvtepi32_epi64(_mm_cmpeq_epi32(idx, _mm_set1_epi32(last - 1)));
+                    p0 = _mm256_blendv_pd(p0, _mm256_sub_pd(_mm256_mul_pd(two, p1), p2), _mm256_castsi256_pd(first));
+                    p3 = _mm256_blendv_pd(p3, _mm256_sub_pd(_mm256_mul_pd(two, p2), p1), _mm256_castsi256_pd(end));
+
+                    auto a = _mm256_add_pd(_mm256_mul_pd(_mm256_set1_pd(3.0), _mm256_sub_pd(p1, p2)), p3);
+                    a = _mm256_sub_pd(a, p0);
+                    auto b = _mm256_sub_pd(_mm256_mul_pd(two, p0), _mm256_mul_pd(_mm256_set1_pd(5.0), p1));
+                    b = _mm256_sub_pd(_mm256_add_pd(b, _mm256_mul_pd(_mm256_set1_pd(4.0), p2)), p3);
+                    auto c = _mm256_sub_pd(p2, p0);
+                    auto res = _mm256_add_pd(b, _mm256_mul_pd(frac, a));
+                    res = _mm256_add_pd(c, _mm256_mul_pd(frac, res));
+                    res = _mm256_mul_pd(_mm256_mul_pd(_mm256_set1_pd(0.5), frac), res);
+                    _mm256_storeu_pd(out + i, _mm256_add_pd(p1, res));
+                }
+                return i;
+            }
+        };
+
+        /**
+         * AVX2 lookup table kernels for float.
+         */
+        template<>
+        struct LutAvx2<float> {
+            static constexpr bool available = true; ///< Kernels are available
+            static constexpr std::size_t lanes = 8; ///< Values per register
+
+            /**
+             * Load the values at eight indices (the masked variant avoids a false uninitialized warning of GCC).
+             * @param values the base address
+             * @param idx the indices
+             * @return the values
+             */
+            SI_TARGET_AVX2 static auto gather(const float *values, __m256i idx) noexcept -> __m256 {
+                auto all = _mm256_castsi256_ps(_mm256_set1_epi32(-1));
+                return _mm256_mask_i32gather_ps(_mm256_setzero_ps(), values, idx, all, sizeof(float));
+            }
+
+            /**
+             * Clamped position and index of the lower sample of eight lanes.
+             * @param x the inputs
+             * @param min the input of the first sample
+             * @param invStep the reciprocal of the distance between two samples
+             * @param last the index of the last sample
+             * @param maxIdx the largest index of the lower sample
+             * @param idx set to the index of the lower sample
+             * @return the distance to the lower sample in units of samples
+             */
+            SI_TARGET_AVX2 static auto fraction(__m256 x, float min, float invStep, std::int32_t last,
+                                                std::int32_t maxIdx, __m256i &idx) noexcept -> __m256 {
+                auto pos = _mm256_mul_ps(_mm256_sub_ps(x, _mm256_set1_ps(min)), _mm256_set1_ps(invStep));
+                pos = _mm256_max_ps(pos, _mm256_setzero_ps()); // The second operand is returned for NaN
+                pos = _mm256_min_ps(pos, _mm256_set1_ps(static_cast<float>(last)));
+                idx = _mm256_min_epi32(_mm256_cvttps_epi32(pos), _mm256_set1_epi32(maxIdx));
+                return _mm256_sub_ps(pos, _mm256_cvtepi32_ps(idx));
+            }
+
+            /**
+             * Linear interpolation.
+             * @param in the inputs
+             * @param out the outputs
+             * @param size the number of values
+             * @param values the samples
+             * @param last the index of the last sample
+             * @param min the input of the first sample
+             * @param invStep the reciprocal of the distance between two samples
+             * @return the number of processed values
+             */
+            SI_TARGET_AVX2 static auto linear(const float *in, float *out, std::size_t size, const float *values,
+                                              std::int32_t last, float min, float invStep) noexcept -> std::size_t {
+                std::size_t i = 0;
+                for (; i + lanes <= size; i += lanes) {
+                    __m256i idx;
+                    auto frac = fraction(_mm256_loadu_ps(in + i), min, invStep, last, last - 1, idx);
+                    auto lower = gather(values, idx);
+                    auto upper = gather(values + 1, idx);
+                    _mm256_storeu_ps(out + i, _mm256_add_ps(lower, _mm256_mul_ps(frac, _mm256_sub_ps(upper, lower))));
+                }
+                return i;
+            }
+
+            /**
+             * Cubic interpolation (Catmull-Rom spline).
+             * @param in the inputs
+             * @param out the outputs
+             * @param size the number of values
+             * @param values the samples
+             * @param last the index of the last sample
+             * @param min the input of the first sample
+             * @param invStep the reciprocal of the distance between two samples
+             * @return the number of processed values
+             */
+            SI_TARGET_AVX2 static auto cubic(const float *in, float *out, std::size_t size, const float *values,
+                                             std::int32_t last, float min, float invStep) noexcept -> std::size_t {
+                const auto two = _mm256_set1_ps(2.0F);
+                std::size_t i = 0;
+                for (; i + lanes <= size; i += lanes) {
+                    __m256i idx;
+                    auto frac = fraction(_mm256_loadu_ps(in + i), min, invStep, last, last - 1, idx);
+                    auto p1 = gather(values, idx);
+                    auto p2 = gather(values + 1, idx);
+                    auto prev = _mm256_max_epi32(_mm256_sub_epi32(idx, _mm256_set1_epi32(1)), _mm256_setzero_si256());
+                    auto next = _mm256_min_epi32(_mm256_add_epi32(idx, _mm256_set1_epi32(2)), _mm256_set1_epi32(last));
+                    auto p0 = gather(values, prev);
+                    auto p3 = gather(values, next);
+                    // At the borders the missing sample is extrapolated linearly
+                    auto first = _mm256_castsi256_ps(_mm256_cmpeq_epi32(idx, _mm256_setzero_si256()));
+                    auto end = _mm256_castsi256_ps(_mm256_cmpeq_epi32(idx, _mm256_set1_epi32(last - 1)));
+                    p0 = _mm256_blendv_ps(p0, _mm256_sub_ps(_mm256_mul_ps(two, p1), p2), first);
+                    p3 = _mm256_blendv_ps(p3, _mm256_sub_ps(_mm256_mul_ps(two, p2), p1), end);
+
+                    auto a = _mm256_add_ps(_mm256_mul_ps(_mm256_set1_ps(3.0F), _mm256_sub_ps(p1, p2)), p3);
+                    a = _mm256_sub_ps(a, p0);
+                    auto b = _mm256_sub_ps(_mm256_mul_ps(two, p0), _mm256_mul_ps(_mm256_set1_ps(5.0F), p1));
+                    b = _mm256_sub_ps(_mm256_add_ps(b, _mm256_mul_ps(_mm256_set1_ps(4.0F), p2)), p3);
+                    auto c = _mm256_sub_ps(p2, p0);
+                    auto res = _mm256_add_ps(b, _mm256_mul_ps(frac, a));
+                    res = _mm256_add_ps(c, _mm256_mul_ps(frac, res));
+                    res = _mm256_mul_ps(_mm256_mul_ps(_mm256_set1_ps(0.5F), frac), res);
+                    _mm256_storeu_ps(out + i, _mm256_add_ps(p1, res));
+                }
+                return i;
+            }
+        };
+#endif
+    } // namespace detail
+
+    /**
+     * Lookup table of a function with N samples on a uniform grid between min and max. The index of a value is
+     * calculated in constant time and inputs outside of [min, max] (and NaN) are clamped to the range. The batch
+     * versions use AVX2 gather kernels for float and double if the CPU supports them (see SiStlBatch.hpp).
+     * @tparam XUnit the SI type of the input
+     * @tparam YUnit the SI type of the output, needs to have the same underlying type as XUnit
+     * @tparam N the number of samples
+     */
+    template<typename XUnit, typename YUnit, std::size_t N>
+    class Lut {
+        static_assert(IsSi<XUnit>::val && IsSi<YUnit>::val, "Lut requires SI types");
+        static_assert(std::is_same_v<typename XUnit::type, typename YUnit::type>,
+                      "Input and output need the same underlying type");
+        static_assert(std::is_floating_point_v<typename XUnit::type>, "Lut requires a floating point type");
+        static_assert(N >= 2 && N <= static_cast<std::size_t>(std::numeric_limits<std::int32_t>::max()),
+                      "Lut requires at least two samples");
+
+      public:
+        using type = typename XUnit::type;     ///< Underlying type of input and output
+        static constexpr std::size_t size = N; ///< Number of samples
+
+        /**
+         * Create a table from samples, e.g. measured at startup.
+         * @param min the input of the first sample
+         * @param max the input of the last sample, needs to be larger than min
+         * @param values the samples, values[i] is the output at min + i * (max - min) / (N - 1)
+         */
+        constexpr Lut(XUnit min, XUnit max, const std::array<YUnit, N> &values) noexcept :
+            min_{static_cast<type>(min)},
+            max_{static_cast<type>(max)},
+            invStep_{static_cast<type>(N - 1) / (max_ - min_)} {
+            assert(min < max && "The range of the table is empty");
+            for (std::size_t i = 0; i < N; ++i) {
+                values_[i] = static_cast<type>(values[i]);
+            }
+        }
+
+        /**
+         * Create a table from samples, e.g. loaded from a calibration file.
+         * @param min the input of the first sample
+         * @param max the input of the last sample, needs to be larger than min
+         * @param values the samples, needs to have N elements
+         */
+        Lut(XUnit min, XUnit max, std::span<const YUnit> values) noexcept :
+            min_{static_cast<type>(min)},
+            max_{static_cast<type>(max)},
+            invStep_{static_cast<type>(N - 1) / (max_ - min_)} {
+            assert(min < max && "The range of the table is empty");
+            assert(values.size() == N && "Wrong number of samples");
+            auto raw = asRaw(values);
+            for (std::size_t i = 0; i < N; ++i) {
+                values_[i] = raw[i];
+            }
+        }
+
+        /**
+         * Create a table by sampling a function, this can be done at compile time if f is constexpr.
+         * @tparam F the type of the function, needs to be callable with XUnit and return YUnit
+         * @param min the first input
+         * @param max the last input, needs to be larger than min
+         * @param f the function
+         * @return the table
+         */
+        template<typename F>
+        static constexpr auto generate(XUnit min, XUnit max, F f) -> Lut {
+            static_assert(std::is_same_v<std::invoke_result_t<F &, XUnit>, YUnit>,
+                          "The function needs to map XUnit to YUnit");
+            std::array<YUnit, N> values{};
+            for (std::size_t i = 0; i < N; ++i) {
+                auto x = (min * static_cast<type>(N - 1 - i) + max * static_cast<type>(i)) / static_cast<type>(N - 1);
+                values[i] = f(i + 1 == N ? max : x);
+            }
+            return Lut{min, max, values};
+        }
+
+        /**
+         * Linear interpolation.
+         * @param x the input, clamped to [min, max]
+         * @return the interpolated output
+         */
+        constexpr auto operator()(XUnit x) const noexcept -> YUnit {
+            return linear(x);
+        }
+
+        /**
+         * Linear interpolation.
+         * @param x the input, clamped to [min, max]
+         * @return the interpolated output
+         */
+        [[nodiscard]] constexpr auto linear(XUnit x) const noexcept -> YUnit {
+            return YUnit{linearRaw(static_cast<type>(x))};
+        }
+
+        /**
+         * Cubic interpolation (Catmull-Rom spline), at the borders the missing samples are extrapolated linearly. The
+         * interpolation is exact for the samples and continuously differentiable between them.
+         * @param x the input, clamped to [min, max]
+         * @return the interpolated output
+         */
+        [[nodiscard]] constexpr auto cubic(XUnit x) const noexcept -> YUnit {
+            return YUnit{cubicRaw(static_cast<type>(x))};
+        }
+
+        /**
+         * Linear interpolation of many values.
+         * @param x the inputs, clamped to [min, max]
+         * @param y the interpolated outputs, needs to have the same size as x
+         */
+        void linear(std::span<const XUnit> x, std::span<YUnit> y) const noexcept {
+            assert(x.size() == y.size() && "Input and output need to have the same size");
+            auto in = asRaw(x);
+            auto out = asRaw(y);
+            std::size_t i = 0;
+#if SI_STL_BATCH_AVX2
+            if constexpr (detail::LutAvx2<type>::available) {
+                if (detail::hasAvx2()) {
+                    i = detail::LutAvx2<type>::linear(in.data(), out.data(), in.size(), values_.data(),
+                                                 static_cast<std::int32_t>(N - 1), min_, invStep_);
+                }
+            }
+#endif
+            for (; i < in.size(); ++i) {
+                out[i] = linearRaw(in[i]);
+            }
+        }
+
+        /**
+         * Cubic interpolation (Catmull-Rom spline) of many values.
+         * @param x the inputs, clamped to [min, max]
+         * @param y the interpolated outputs, needs to have the same size as x
+         */
+        void cubic(std::span<const XUnit> x, std::span<YUnit> y) const noexcept {
+            assert(x.size() == y.size() && "Input and output need to have the same size");
+            auto in = asRaw(x);
+            auto out = asRaw(y);
+            std::size_t i = 0;
+#if SI_STL_BATCH_AVX2
+            if constexpr (detail::LutAvx2<type>::available) {
+                if (detail::hasAvx2()) {
+                    i = detail::LutAvx2<type>::cubic(in.data(), out.data(), in.size(), values_.data(),
+                                                 static_cast<std::int32_t>(N - 1), min_, invStep_);
+                }
+            }
+#endif
+            for (; i < in.size(); ++i) {
+                out[i] = cubicRaw(in[i]);
+            }
+        }
+
+        /**
+         * The input of the first sample.
+         * @return the lower end of the range
+         */
+        [[nodiscard]] constexpr auto min() const noexcept -> XUnit {
+            return XUnit{min_};
+        }
+
+        /**
+         * The input of the last sample.
+         * @return the upper end of the range
+         */
+        [[nodiscard]] constexpr auto max() const noexcept -> XUnit {
+            return XUnit{max_};
+        }
+
+        /**
+         * A single sample.
+         * @param i the index of the sample
+         * @return the output at min + i * (max - min) / (N - 1)
+         */
+        [[nodiscard]] constexpr auto operator[](std::size_t i) const noexcept -> YUnit {
+            assert(i < N && "Index out of range");
+            return YUnit{values_[i]};
+        }
+
+      private:
+        /**
+         * Position of an input in units of samples, clamped to [0, N - 1] (NaN is mapped to 0).
+         */
+        constexpr auto position(type x) const noexcept -> type {
+            auto pos = (x - min_) * invStep_;
+            pos = pos > type{0} ? pos : type{0};
+            return pos < static_cast<type>(N - 1) ? pos : static_cast<type>(N - 1);
+        }
+
+        constexpr auto linearRaw(type x) const noexcept -> type {
+            auto pos = position(x);
+            auto idx = static_cast<std::int32_t>(pos);
+            idx = idx < static_cast<std::int32_t>(N - 2) ? idx : static_cast<std::int32_t>(N - 2);
+            auto frac = pos - static_cast<type>(idx);
+            auto lower = values_[static_cast<std::size_t>(idx)];
+            auto upper = values_[static_cast<std::size_t>(idx + 1)];
+            return lower + frac * (upper - lower);
+        }
+
+        constexpr auto cubicRaw(type x) const noexcept -> type {
+            constexpr auto last = static_cast<std::int32_t>(N - 1);
+            auto pos = position(x);
+            auto idx = static_cast<std::int32_t>(pos);
+            idx = idx < last - 1 ? idx : last - 1;
+            auto frac = pos - static_cast<type>(idx);
+            auto p1 = values_[static_cast<std::size_t>(idx)];
+            auto p2 = values_[static_cast<std::size_t>(idx + 1)];
+            // At the borders the missing sample is extrapolated linearly
+            auto p0 = idx > 0 ? values_[static_cast<std::size_t>(idx > 0 ? idx - 1 : 0)] : type{2} * p1 - p2;
+            auto p3 = idx + 2 <= last ? values_[static_cast<std::size_t>(idx + 2 <= last ? idx + 2 : last)]
+                                      : type{2} * p2 - p1;
+            auto a = type{3} * (p1 - p2) + p3 - p0;
+            auto b = type{2} * p0 - type{5} * p1 + type{4} * p2 - p3;
+            auto c = p2 - p0;
+            return p1 + type{0.5} * frac * (c + frac * (b + frac * a));
+        }
+
+        type min_;
+        type max_;
+        type invStep_;
+        std::array<type, N> values_{};
+    };
+} // namespace si
+
+#endif
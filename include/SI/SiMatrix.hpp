@@ -0,0 +1,525 @@
+/**
+ * @file SiMatrix.hpp
+ * @author paul
+ * @date 17.10.26
+ * @brief Fixed size vectors and matrices whose entries have different units (e.g. state vectors and covariances of
+ * filters), the unit of every entry is known at compile time.
+ * @ingroup SI
+ */
+#ifndef SI_SIMATRIX_HPP
+#define SI_SIMATRIX_HPP
+
+#include <array>
+#include <cstddef>
+#include <optional>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+#include "SiImpl.hpp"
+
+namespace si {
+    /**
+     * List of SI types, used for the units of the rows and columns of a matrix.
+     * @tparam SiTs the SI types
+     */
+    template<typename... SiTs>
+    struct Units {
+        static constexpr std::size_t size = sizeof...(SiTs); ///< Number of units
+    };
+
+    /**
+     * Matrix with a unit per row and a unit per column, the unit of the entry (i, j) is the product of the unit of
+     * row i and the unit of column j. This is the structure of all matrices which map between physical vectors, e.g.
+     * a covariance of a state x has the units x_i * x_j, a transition matrix has the units x_i / x_j.
+     * @tparam RowUnits the units of the rows as Units<...>
+     * @tparam ColUnits the units of the columns as Units<...>
+     */
+    template<typename RowUnits, typename ColUnits>
+    class Mat;
+
+    namespace detail {
+        /**
+         * Reciprocal of an SI type.
+         */
+        template<typename SiT>
+        using Reciprocal =
+                Si<-SiT::meter, -SiT::kilogram, -SiT::second, -SiT::ampere, -SiT::kelvin, -SiT::mole, -SiT::candela,
+                   typename SiT::type>;
+
+        /**
+         * The I-th type of a list.
+         */
+        template<std::size_t I, typename... Ts>
+        using Nth = std::tuple_element_t<I, std::tuple<Ts...>>;
+
+        /**
+         * Unitless SI type with the underlying type of the first SI type of a list.
+         */
+        template<typename... SiTs>
+        using ScalarOf = Si<0, 0, 0, 0, 0, 0, 0, typename Nth<0, SiTs...>::type>;
+
+        /**
+         * Product of two SI types as calculated by Si::operator*.
+         */
+        template<typename SiT1, typename SiT2>
+        using Product = decltype(std::declval<SiT1>() * std::declval<SiT2>());
+
+        /**
+         * Alignment of the storage of a matrix: large matrices are aligned for 256 bit SIMD registers.
+         */
+        template<typename T, std::size_t N>
+        constexpr std::size_t matrixAlignment = sizeof(T) * N >= 32 && alignof(T) <= 32 ? 32 : alignof(T);
+
+        /**
+         * Checks whether two matrices have the same unit for every entry (the units of rows and columns are only
+         * defined up to a common factor).
+         */
+        template<typename Mat1, typename Mat2, typename = std::make_index_sequence<Mat1::rows * Mat1::cols>>
+        struct SameEntryUnits {
+            static constexpr auto val = false; ///< Different sizes
+        };
+
+        /**
+         * Specialization of SameEntryUnits for matrices of the same size.
+         */
+        template<typename Mat1, typename Mat2, std::size_t... Idx>
+        struct SameEntryUnits<Mat1, Mat2, std::index_sequence<Idx...>> {
+            /**
+             * True if the matrices have the same size and all entries have the same unit.
+             */
+            static constexpr auto val = [] {
+                if constexpr (Mat1::rows == Mat2::rows && Mat1::cols == Mat2::cols) {
+                    return (std::is_same_v<typename Mat1::template unit<Idx / Mat1::cols, Idx % Mat1::cols>,
+                                           typename Mat2::template unit<Idx / Mat1::cols, Idx % Mat1::cols>> &&
+                            ...);
+                } else {
+                    return false;
+                }
+            }();
+        };
+    } // namespace detail
+
+    /**
+     * Column vector with a unit per entry, e.g. Vec<Meter<>, Speed<>, Acceleration<>>.
+     * @tparam SiTs the units of the entries
+     */
+    template<typename... SiTs>
+    using Vec = Mat<Units<SiTs...>, Units<detail::ScalarOf<SiTs...>>>;
+
+    /**
+     * Specialization of Mat for lists of units.
+     * @tparam Rows the units of the rows
+     * @tparam Cols the units of the columns
+     */
+    template<typename... Rows, typename... Cols>
+    class Mat<Units<Rows...>, Units<Cols...>> {
+        static_assert(sizeof...(Rows) > 0 && sizeof...(Cols) > 0, "A matrix requires at least one row and column");
+        static_assert((IsSi<Rows>::val && ...) && (IsSi<Cols>::val && ...), "The units need to be SI types");
+
+      public:
+        using type = typename detail::Nth<0, Rows...>::type; ///< Underlying numerical type of all entries
+        static_assert((std::is_same_v<typename Rows::type, type> && ...) &&
+                              (std::is_same_v<typename Cols::type, type> && ...),
+                      "All units need to have the same underlying type");
+
+        using row_units = Units<Rows...>;                     ///< Units of the rows
+        using col_units = Units<Cols...>;                     ///< Units of the columns
+        static constexpr std::size_t rows = sizeof...(Rows); ///< Number of rows
+        static constexpr std::size_t cols = sizeof...(Cols); ///< Number of columns
+
+        /**
+         * The unit of the entry (I, J).
+         */
+        template<std::size_t I, std::size_t J>
+        using unit = detail::Product<detail::Nth<I, Rows...>, detail::Nth<J, Cols...>>;
+
+        /**
+         * Create a matrix with all entries zero.
+         */
+        constexpr Mat() noexcept = default;
+
+        /**
+         * Create a column vector from its entries.
+         * @tparam C the number of columns, needs to be one
+         * @param vals the entries
+         */
+        template<std::size_t C = cols, std::enable_if_t<C == 1, bool> = true>
+        constexpr explicit Mat(Rows... vals) noexcept : raw_{static_cast<type>(vals)...} {
+        }
+
+        /**
+         * Create a matrix with entries of another matrix which has the same units for all entries (but possibly
+         * different units for the rows and columns).
+         * @tparam Mat_ the type of the other matrix
+         * @param other the other matrix
+         */
+        template<typename Mat_, std::enable_if_t<!std::is_same_v<Mat_, Mat> && detail::SameEntryUnits<Mat_, Mat>::val,
+                                                 bool> = true>
+        constexpr Mat(const Mat_ &other) noexcept /* NOLINT(google-explicit-constructor) */ : raw_{other.raw()} {
+        }
+
+        /**
+         * Create a matrix from the underlying values.
+         * @param raw the entries in row major order
+         * @return the matrix
+         */
+        static constexpr auto fromRaw(const std::array<type, rows * cols> &raw) noexcept -> Mat {
+            Mat res;
+            res.raw_ = raw;
+            return res;
+        }
+
+        /**
+         * Identity matrix, requires that all entries on the diagonal are unitless.
+         * @return the identity matrix
+         */
+        static constexpr auto identity() noexcept -> Mat {
+            static_assert(rows == cols, "Only square matrices have an identity");
+            static_assert(diagonalUnitless(std::make_index_sequence<rows>{}),
+                          "The identity requires unitless entries on the diagonal");
+            Mat res;
+            for (std::size_t i = 0; i < rows; ++i) {
+                res.raw_[i * cols + i] = type{1};
+            }
+            return res;
+        }
+
+        /**
+         * Read an entry.
+         * @tparam I the row
+         * @tparam J the column
+         * @return the entry with its unit
+         */
+        template<std::size_t I, std::size_t J>
+        [[nodiscard]] constexpr auto get() const noexcept -> unit<I, J> {
+            static_assert(I < rows && J < cols, "Index out of range");
+            return unit<I, J>{raw_[I * cols + J]};
+        }
+
+        /**
+         * Read an entry of a column vector.
+         * @tparam I the row
+         * @return the entry with its unit
+         */
+        template<std::size_t I>
+        [[nodiscard]] constexpr auto get() const noexcept -> unit<I, 0> {
+            static_assert(cols == 1, "Single index access requires a column vector");
+            return get<I, 0>();
+        }
+
+        /**
+         * Write an entry.
+         * @tparam I the row
+         * @tparam J the column
+         * @param val the value with the unit of the entry
+         */
+        template<std::size_t I, std::size_t J>
+        constexpr void set(unit<I, J> val) noexcept {
+            static_assert(I < rows && J < cols, "Index out of range");
+            raw_[I * cols + J] = static_cast<type>(val);
+        }
+
+        /**
+         * Write an entry of a column vector.
+         * @tparam I the row
+         * @param val the value with the unit of the entry
+         */
+        template<std::size_t I>
+        constexpr void set(unit<I, 0> val) noexcept {
+            static_assert(cols == 1, "Single index access requires a column vector");
+            set<I, 0>(val);
+        }
+
+        /**
+         * The underlying values.
+         * @return all entries in row major order
+         */
+        [[nodiscard]] constexpr auto raw() const noexcept -> const std::array<type, rows * cols> & {
+            return raw_;
+        }
+
+        /**
+         * The underlying values.
+         * @return all entries in row major order
+         */
+        [[nodiscard]] constexpr auto raw() noexcept -> std::array<type, rows * cols> & {
+            return raw_;
+        }
+
+        /**
+         * Add a matrix with the same units.
+         * @param rhs the matrix to add
+         * @return the sum
+         */
+        constexpr auto operator+(const Mat &rhs) const noexcept -> Mat {
+            Mat res;
+            for (std::size_t i = 0; i < rows * cols; ++i) {
+                res.raw_[i] = raw_[i] + rhs.raw_[i];
+            }
+            return res;
+        }
+
+        /**
+         * Subtract a matrix with the same units.
+         * @param rhs the matrix to subtract
+         * @return the difference
+         */
+        constexpr auto operator-(const Mat &rhs) const noexcept -> Mat {
+            Mat res;
+            for (std::size_t i = 0; i < rows * cols; ++i) {
+                res.raw_[i] = raw_[i] - rhs.raw_[i];
+            }
+            return res;
+        }
+
+        /**
+         * Increment by a matrix with the same units.
+         * @param rhs the matrix to add
+         * @return this matrix
+         */
+        constexpr auto operator+=(const Mat &rhs) noexcept -> Mat & {
+            return *this = *this + rhs;
+        }
+
+        /**
+         * Decrement by a matrix with the same units.
+         * @param rhs the matrix to subtract
+         * @return this matrix
+         */
+        constexpr auto operator-=(const Mat &rhs) noexcept -> Mat & {
+            return *this = *this - rhs;
+        }
+
+        /**
+         * Negate all entries.
+         * @return the negative matrix
+         */
+        constexpr auto operator-() const noexcept -> Mat {
+            Mat res;
+            for (std::size_t i = 0; i < rows * cols; ++i) {
+                res.raw_[i] = -raw_[i];
+            }
+            return res;
+        }
+
+        /**
+         * Scale all entries with a unitless factor.
+         * @param rhs the factor
+         * @return the scaled matrix
+         */
+        constexpr auto operator*(type rhs) const noexcept -> Mat {
+            Mat res;
+            for (std::size_t i = 0; i < rows * cols; ++i) {
+                res.raw_[i] = raw_[i] * rhs;
+            }
+            return res;
+        }
+
+        /**
+         * Scale all entries with a factor with unit, the unit of all entries is multiplied by the unit of the
+         * factor.
+         * @tparam m the meter exponent
+         * @tparam kg the kilogram exponent
+         * @tparam s the second exponent
+         * @tparam A the Ampere exponent
+         * @tparam K the Kelvin exponent
+         * @tparam MOL the Mol exponent
+         * @tparam CD the Candela exponent
+         * @param rhs the factor
+         * @return the scaled matrix
+         */
+        template<int m, int kg, int s, int A, int K, int MOL, int CD>
+        constexpr auto operator*(Si<m, kg, s, A, K, MOL, CD, type> rhs) const noexcept {
+            using Res = Mat<Units<detail::Product<Rows, Si<m, kg, s, A, K, MOL, CD, type>>...>, Units<Cols...>>;
+            return Res::fromRaw((*this * static_cast<type>(rhs)).raw_);
+        }
+
+        /**
+         * Divide all entries by a unitless factor.
+         * @param rhs the divisor
+         * @return the scaled matrix
+         */
+        constexpr auto operator/(type rhs) const noexcept -> Mat {
+            Mat res;
+            for (std::size_t i = 0; i < rows * cols; ++i) {
+                res.raw_[i] = raw_[i] / rhs;
+            }
+            return res;
+        }
+
+      private:
+        template<std::size_t... I>
+        static constexpr auto diagonalUnitless(std::index_sequence<I...> /*indices*/) -> bool {
+            return (std::is_same_v<unit<I, I>, Si<0, 0, 0, 0, 0, 0, 0, type>> && ...);
+        }
+
+        alignas(detail::matrixAlignment<type, rows * cols>) std::array<type, rows * cols> raw_{};
+    };
+
+    /**
+     * Scale all entries of a matrix with a unitless factor.
+     * @tparam RowUnits the units of the rows
+     * @tparam ColUnits the units of the columns
+     * @param lhs the factor
+     * @param rhs the matrix
+     * @return the scaled matrix
+     */
+    template<typename RowUnits, typename ColUnits>
+    constexpr auto operator*(typename Mat<RowUnits, ColUnits>::type lhs, const Mat<RowUnits, ColUnits> &rhs) noexcept
+            -> Mat<RowUnits, ColUnits> {
+        return rhs * lhs;
+    }
+
+    namespace detail {
+        /**
+         * Entry (I, J) of the product of two matrices, the sum is unrolled at compile time.
+         */
+        template<std::size_t I, std::size_t J, std::size_t Inner, std::size_t Cols, typename T, std::size_t N1,
+                 std::size_t N2, std::size_t... K>
+        constexpr auto productEntry(const std::array<T, N1> &lhs, const std::array<T, N2> &rhs,
+                                    std::index_sequence<K...> /*inner*/) noexcept -> T {
+            return ((lhs[I * Inner + K] * rhs[K * Cols + J]) + ...);
+        }
+
+        /**
+         * All entries of the product of two matrices, completely unrolled at compile time.
+         */
+        template<std::size_t Rows, std::size_t Inner, std::size_t Cols, typename T, std::size_t N1, std::size_t N2,
+                 std::size_t... Idx>
+        constexpr auto product(const std::array<T, N1> &lhs, const std::array<T, N2> &rhs,
+                               std::index_sequence<Idx...> /*entries*/) noexcept -> std::array<T, Rows * Cols> {
+            return {productEntry<Idx / Cols, Idx % Cols, Inner, Cols>(lhs, rhs, std::make_index_sequence<Inner>{})...};
+        }
+    } // namespace detail
+
+    /**
+     * Product of two matrices, the unit of every entry is derived from the units of the factors. For every k the
+     * product of the unit of column k of lhs and the unit of row k of rhs needs to be the same unit (otherwise the
+     * entries of the sum would have different units). The product is unrolled completely and does not allocate.
+     * @tparam Rows1 the units of the rows of lhs
+     * @tparam Cols1 the units of the columns of lhs
+     * @tparam Rows2 the units of the rows of rhs
+     * @tparam Cols2 the units of the columns of rhs
+     * @param lhs the left factor
+     * @param rhs the right factor
+     * @return the product
+     */
+    template<typename... Rows1, typename... Cols1, typename... Rows2, typename... Cols2>
+    constexpr auto operator*(const Mat<Units<Rows1...>, Units<Cols1...>> &lhs,
+                             const Mat<Units<Rows2...>, Units<Cols2...>> &rhs) noexcept {
+        static_assert(sizeof...(Cols1) == sizeof...(Rows2),
+                      "The number of columns of lhs needs to be the number of rows of rhs");
+        using Inner = detail::Product<detail::Nth<0, Cols1...>, detail::Nth<0, Rows2...>>;
+        static_assert((std::is_same_v<detail::Product<Cols1, Rows2>, Inner> && ...),
+                      "The products of the entries have different units");
+        using Res = Mat<Units<detail::Product<Rows1, Inner>...>, Units<Cols2...>>;
+        constexpr auto rows = sizeof...(Rows1);
+        constexpr auto inner = sizeof...(Cols1);
+        constexpr auto cols = sizeof...(Cols2);
+        return Res::fromRaw(
+                detail::product<rows, inner, cols>(lhs.raw(), rhs.raw(), std::make_index_sequence<rows * cols>{}));
+    }
+
+    /**
+     * Transpose of a matrix, the units of the rows and columns are swapped.
+     * @tparam RowUnits the units of the rows
+     * @tparam ColUnits the units of the columns
+     * @param mat the matrix
+     * @return the transposed matrix
+     */
+    template<typename RowUnits, typename ColUnits>
+    constexpr auto transpose(const Mat<RowUnits, ColUnits> &mat) noexcept -> Mat<ColUnits, RowUnits> {
+        constexpr auto rows = RowUnits::size;
+        constexpr auto cols = ColUnits::size;
+        std::array<typename Mat<RowUnits, ColUnits>::type, rows * cols> res{};
+        for (std::size_t i = 0; i < rows; ++i) {
+            for (std::size_t j = 0; j < cols; ++j) {
+                res[j * rows + i] = mat.raw()[i * cols + j];
+            }
+        }
+        return Mat<ColUnits, RowUnits>::fromRaw(res);
+    }
+
+    /**
+     * Outer product of two vectors, i.e. lhs * transpose(rhs).
+     * @tparam Rows1 the units of lhs
+     * @tparam Col1 the unit of the column of lhs
+     * @tparam Rows2 the units of rhs
+     * @tparam Col2 the unit of the column of rhs
+     * @param lhs the left vector
+     * @param rhs the right vector
+     * @return the matrix with the entries lhs_i * rhs_j
+     */
+    template<typename Rows1, typename Col1, typename Rows2, typename Col2>
+    constexpr auto outer(const Mat<Rows1, Units<Col1>> &lhs, const Mat<Rows2, Units<Col2>> &rhs) noexcept {
+        return lhs * transpose(rhs);
+    }
+
+    /**
+     * Inverse of a square matrix using Gauss-Jordan elimination with partial pivoting. The inverse of a matrix with
+     * the units r_i * c_j has the units 1 / (c_i * r_j), so A * inverse(A) has unitless entries on the diagonal.
+     * @tparam Rows the units of the rows
+     * @tparam Cols the units of the columns
+     * @param mat the matrix
+     * @return the inverse, std::nullopt if the matrix is singular
+     */
+    template<typename... Rows, typename... Cols>
+    constexpr auto inverse(const Mat<Units<Rows...>, Units<Cols...>> &mat) noexcept
+            -> std::optional<Mat<Units<detail::Reciprocal<Cols>...>, Units<detail::Reciprocal<Rows>...>>> {
+        constexpr auto n = sizeof...(Rows);
+        static_assert(n == sizeof...(Cols), "Only square matrices can be inverted");
+        using T = typename Mat<Units<Rows...>, Units<Cols...>>::type;
+        using Res = Mat<Units<detail::Reciprocal<Cols>...>, Units<detail::Reciprocal<Rows>...>>;
+
+        auto lhs = mat.raw();
+        std::array<T, n * n> res{};
+        for (std::size_t i = 0; i < n; ++i) {
+            res[i * n + i] = T{1};
+        }
+
+        for (std::size_t col = 0; col < n; ++col) {
+            auto pivot = col;
+            auto pivotAbs = lhs[col * n + col] < T{0} ? -lhs[col * n + col] : lhs[col * n + col];
+            for (std::size_t row = col + 1; row < n; ++row) {
+                auto abs = lhs[row * n + col] < T{0} ? -lhs[row * n + col] : lhs[row * n + col];
+                if (abs > pivotAbs) {
+                    pivot = row;
+                    pivotAbs = abs;
+                }
+            }
+            if (pivotAbs == T{0}) {
+                return std::nullopt;
+            }
+            if (pivot != col) {
+                for (std::size_t j = 0; j < n; ++j) {
+                    auto tmp = lhs[col * n + j];
+                    lhs[col * n + j] = lhs[pivot * n + j];
+                    lhs[pivot * n + j] = tmp;
+                    tmp = res[col * n + j];
+                    res[col * n + j] = res[pivot * n + j];
+                    res[pivot * n + j] = tmp;
+                }
+            }
+
+            auto scale = T{1} / lhs[col * n + col];
+            for (std::size_t j = 0; j < n; ++j) {
+                lhs[col * n + j] *= scale;
+                res[col * n + j] *= scale;
+            }
+            for (std::size_t row = 0; row < n; ++row) {
+                auto factor = lhs[row * n + col];
+                if (row == col || factor == T{0}) {
+                    continue;
+                }
+                for (std::size_t j = 0; j < n; ++j) {
+                    lhs[row * n + j] -= factor * lhs[col * n + j];
+                    res[row * n + j] -= factor * res[col * n + j];
+                }
+            }
+        }
+        return Res::fromRaw(res);
+    }
+} // namespace si
+
+#endif
@@ -0,0 +1,299 @@
+/**
+ * @file SiOde.hpp
+ * @author paul
+ * @date 17.10.26
+ * @brief Fixed step integrators (explicit Euler, semi-implicit Euler and Runge-Kutta 4) for states consisting of SI
+ * values, the units of the derivatives are checked at compile time. Requires C++20.
+ * @ingroup SI
+ */
+#ifndef SI_SIODE_HPP
+#define SI_SIODE_HPP
+
+#include <cassert>
+#include <cstddef>
+#include <span>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+#include "SiImpl.hpp"
+
+namespace si {
+    namespace detail {
+        /**
+         * Checks whether a type is a std::tuple.
+         */
+        template<typename T>
+        struct IsTuple {
+            static constexpr auto val = false; ///< Not a tuple
+        };
+
+        /**
+         * Specialization of IsTuple for tuples.
+         */
+        template<typename... Ts>
+        struct IsTuple<std::tuple<Ts...>> {
+            static constexpr auto val = true; ///< A tuple
+        };
+
+        /**
+         * Time derivative of a state, a single SI value or a tuple of SI values.
+         */
+        template<typename State, typename TimeT>
+        struct DerivativeImpl {
+            static_assert(IsSi<State>::val, "The state needs to be an SI type or a tuple of SI types");
+            using type = decltype(std::declval<State>() / std::declval<TimeT>()); ///< Derivative of the value
+        };
+
+        /**
+         * Specialization of DerivativeImpl for tuples.
+         */
+        template<typename... SiTs, typename TimeT>
+        struct DerivativeImpl<std::tuple<SiTs...>, TimeT> {
+            using type = std::tuple<typename DerivativeImpl<SiTs, TimeT>::type...>; ///< Derivatives of all elements
+        };
+
+        /**
+         * Apply an operation to the I-th elements of tuples.
+         */
+        template<std::size_t I, typename Op, typename... Tuples>
+        constexpr auto elementAt(Op &op, const Tuples &...tuples) {
+            return op(std::get<I>(tuples)...);
+        }
+
+        /**
+         * Apply an operation to the corresponding elements of tuples.
+         */
+        template<typename Op, std::size_t... I, typename... Tuples>
+        constexpr auto elementwiseImpl(Op op, std::index_sequence<I...> /*indices*/, const Tuples &...tuples) {
+            return std::make_tuple(elementAt<I>(op, tuples...)...);
+        }
+
+        /**
+         * Apply an operation to single SI values or to the corresponding elements of tuples.
+         * @param op the operation
+         * @param first the first argument
+         * @param rest the other arguments, need to have the same structure as first
+         * @return the result, a tuple if the arguments are tuples
+         */
+        template<typename Op, typename First, typename... Rest>
+        constexpr auto elementwise(Op op, const First &first, const Rest &...rest) {
+            if constexpr (IsTuple<First>::val) {
+                return elementwiseImpl(op, std::make_index_sequence<std::tuple_size_v<First>>{}, first, rest...);
+            } else {
+                return op(first, rest...);
+            }
+        }
+
+        /**
+         * One explicit step state + derivative * dt, the result has the type of the state.
+         */
+        template<typename State, typename Derivative, typename TimeT>
+        constexpr auto advance(const State &state, const Derivative &derivative, TimeT dt) -> State {
+            return elementwise(
+                    [dt](auto val, auto diff) { return static_cast<decltype(val)>(val + diff * dt); }, state,
+                    derivative);
+        }
+
+        /**
+         * Check the result type of a derivative function.
+         */
+        template<typename Derivative, typename Expected>
+        constexpr void checkDerivative() {
+            static_assert(std::is_same_v<Derivative, Expected>,
+                          "The derivative needs to have the units of the state divided by second");
+        }
+
+        /**
+         * Apply a step to all rollouts of a batch of states stored as structure of arrays.
+         */
+        template<typename Step, typename... SiTs, std::size_t... I>
+        void stepAll(Step step, const std::tuple<std::span<SiTs>...> &states, std::index_sequence<I...> /*indices*/) {
+            auto size = std::get<0>(states).size();
+            assert(((std::get<I>(states).size() == size) && ...) && "All spans need to have the same size");
+            for (std::size_t i = 0; i < size; ++i) {
+                auto next = step(std::tuple<SiTs...>{std::get<I>(states)[i]...}, i);
+                ((std::get<I>(states)[i] = std::get<I>(next)), ...);
+            }
+        }
+
+        /**
+         * The elements [Offset, Offset + sizeof...(I)) of a tuple.
+         */
+        template<std::size_t Offset, typename Tuple, std::size_t... I>
+        constexpr auto slice(const Tuple &tuple, std::index_sequence<I...> /*indices*/) {
+            return std::make_tuple(std::get<Offset + I>(tuple)...);
+        }
+
+        /**
+         * Call a derivative function of a batch, which optionally receives the index of the rollout as last argument
+         * (e.g. to look up the control input of the rollout).
+         */
+        template<typename F, typename... Args>
+        constexpr auto callRollout(F &f, std::size_t rollout, const Args &...args) {
+            if constexpr (std::is_invocable_v<F &, const Args &..., std::size_t>) {
+                return f(args..., rollout);
+            } else {
+                return f(args...);
+            }
+        }
+    } // namespace detail
+
+    /**
+     * Time derivative of a state: the units of the state (a single SI type or a std::tuple of SI types) divided by
+     * second.
+     * @tparam State the state
+     * @tparam T the underlying type of the time
+     */
+    template<typename State, typename T = default_type>
+    using Derivative = typename detail::DerivativeImpl<State, Si<0, 0, 1, 0, 0, 0, 0, T>>::type;
+
+    /**
+     * Explicit (forward) Euler step.
+     * @tparam F the type of the derivative function
+     * @tparam State the state, an SI type or a std::tuple of SI types
+     * @tparam T the underlying type of the time
+     * @param f the derivative function f(t, state), needs to return Derivative<State, T>
+     * @param state the current state
+     * @param t the current time
+     * @param dt the step size
+     * @return the state at t + dt
+     */
+    template<typename F, typename State, typename T>
+    constexpr auto eulerStep(F f, const State &state, Si<0, 0, 1, 0, 0, 0, 0, T> t, Si<0, 0, 1, 0, 0, 0, 0, T> dt)
+            -> State {
+        auto derivative = f(t, state);
+        detail::checkDerivative<decltype(derivative), Derivative<State, T>>();
+        return detail::advance(state, derivative, dt);
+    }
+
+    /**
+     * Classical fourth order Runge-Kutta step.
+     * @tparam F the type of the derivative function
+     * @tparam State the state, an SI type or a std::tuple of SI types
+     * @tparam T the underlying type of the time
+     * @param f the derivative function f(t, state), needs to return Derivative<State, T>
+     * @param state the current state
+     * @param t the current time
+     * @param dt the step size
+     * @return the state at t + dt
+     */
+    template<typename F, typename State, typename T>
+    constexpr auto rk4Step(F f, const State &state, Si<0, 0, 1, 0, 0, 0, 0, T> t, Si<0, 0, 1, 0, 0, 0, 0, T> dt)
+            -> State {
+        auto halfStep = dt / static_cast<T>(2);
+        auto k1 = f(t, state);
+        detail::checkDerivative<decltype(k1), Derivative<State, T>>();
+        auto k2 = f(t + halfStep, detail::advance(state, k1, halfStep));
+        auto k3 = f(t + halfStep, detail::advance(state, k2, halfStep));
+        auto k4 = f(t + dt, detail::advance(state, k3, dt));
+        auto sum = detail::elementwise([](auto a, auto b, auto c, auto d) { return a + (b + c) + (b + c) + d; }, k1,
+                                       k2, k3, k4);
+        return detail::advance(state, sum, dt / static_cast<T>(6));
+    }
+
+    /**
+     * Semi-implicit (symplectic) Euler step for second order systems: the velocity is updated first, the position is
+     * updated with the new velocity. Conserves the energy of oscillating systems much better than the explicit Euler
+     * step at the same cost.
+     * @tparam A the type of the acceleration function
+     * @tparam Pos the position, an SI type or a std::tuple of SI types
+     * @tparam Vel the velocity, needs to be Derivative<Pos, T>
+     * @tparam T the underlying type of the time
+     * @param accel the acceleration function accel(t, pos, vel), needs to return Derivative<Vel, T>
+     * @param pos the current position
+     * @param vel the current velocity
+     * @param t the current time
+     * @param dt the step size
+     * @return the position and the velocity at t + dt
+     */
+    template<typename A, typename Pos, typename Vel, typename T>
+    constexpr auto semiImplicitEulerStep(A accel, const Pos &pos, const Vel &vel, Si<0, 0, 1, 0, 0, 0, 0, T> t,
+                                         Si<0, 0, 1, 0, 0, 0, 0, T> dt) -> std::pair<Pos, Vel> {
+        detail::checkDerivative<Vel, Derivative<Pos, T>>();
+        auto acceleration = accel(t, pos, vel);
+        detail::checkDerivative<decltype(acceleration), Derivative<Vel, T>>();
+        auto nextVel = detail::advance(vel, acceleration, dt);
+        return {detail::advance(pos, nextVel, dt), nextVel};
+    }
+
+    /**
+     * Explicit Euler step of many independent rollouts stored as structure of arrays (one span per element of the
+     * state), the loop over the rollouts is vectorized by the compiler if f can be inlined.
+     * @tparam F the type of the derivative function
+     * @tparam SiTs the elements of the state
+     * @tparam T the underlying type of the time
+     * @param f the derivative function f(t, state) or f(t, state, rollout) with state of type std::tuple<SiTs...>
+     * @param states the states of all rollouts, updated in place, all spans need to have the same size
+     * @param t the current time
+     * @param dt the step size
+     */
+    template<typename F, typename... SiTs, typename T>
+    void eulerStep(F f, std::tuple<std::span<SiTs>...> states, Si<0, 0, 1, 0, 0, 0, 0, T> t,
+                   Si<0, 0, 1, 0, 0, 0, 0, T> dt) {
+        detail::stepAll(
+                [&](const std::tuple<SiTs...> &state, std::size_t rollout) {
+                    auto derivative = [&](auto t_, const auto &state_) {
+                        return detail::callRollout(f, rollout, t_, state_);
+                    };
+                    return eulerStep(derivative, state, t, dt);
+                },
+                states, std::index_sequence_for<SiTs...>{});
+    }
+
+    /**
+     * Runge-Kutta 4 step of many independent rollouts stored as structure of arrays (one span per element of the
+     * state), the loop over the rollouts is vectorized by the compiler if f can be inlined.
+     * @tparam F the type of the derivative function
+     * @tparam SiTs the elements of the state
+     * @tparam T the underlying type of the time
+     * @param f the derivative function f(t, state) or f(t, state, rollout) with state of type std::tuple<SiTs...>
+     * @param states the states of all rollouts, updated in place, all spans need to have the same size
+     * @param t the current time
+     * @param dt the step size
+     */
+    template<typename F, typename... SiTs, typename T>
+    void rk4Step(F f, std::tuple<std::span<SiTs>...> states, Si<0, 0, 1, 0, 0, 0, 0, T> t,
+                 Si<0, 0, 1, 0, 0, 0, 0, T> dt) {
+        detail::stepAll(
+                [&](const std::tuple<SiTs...> &state, std::size_t rollout) {
+                    auto derivative = [&](auto t_, const auto &state_) {
+                        return detail::callRollout(f, rollout, t_, state_);
+                    };
+                    return rk4Step(derivative, state, t, dt);
+                },
+                states, std::index_sequence_for<SiTs...>{});
+    }
+
+    /**
+     * Semi-implicit Euler step of many independent rollouts stored as structure of arrays.
+     * @tparam A the type of the acceleration function
+     * @tparam PosTs the elements of the position
+     * @tparam VelTs the elements of the velocity
+     * @tparam T the underlying type of the time
+     * @param accel the acceleration function accel(t, pos, vel) or accel(t, pos, vel, rollout) with pos of type
+     * std::tuple<PosTs...> and vel of type std::tuple<VelTs...>
+     * @param pos the positions of all rollouts, updated in place
+     * @param vel the velocities of all rollouts, updated in place, all spans need to have the same size
+     * @param t the current time
+     * @param dt the step size
+     */
+    template<typename A, typename... PosTs, typename... VelTs, typename T>
+    void semiImplicitEulerStep(A accel, std::tuple<std::span<PosTs>...> pos, std::tuple<std::span<VelTs>...> vel,
+                               Si<0, 0, 1, 0, 0, 0, 0, T> t, Si<0, 0, 1, 0, 0, 0, 0, T> dt) {
+        static_assert(sizeof...(PosTs) == sizeof...(VelTs), "Position and velocity need the same number of elements");
+        detail::stepAll(
+                [&](const std::tuple<PosTs..., VelTs...> &state, std::size_t rollout) {
+                    auto [nextPos, nextVel] = semiImplicitEulerStep(
+                            [&](auto t_, const auto &pos_, const auto &vel_) {
+                                return detail::callRollout(accel, rollout, t_, pos_, vel_);
+                            },
+                            detail::slice<0>(state, std::index_sequence_for<PosTs...>{}),
+                            detail::slice<sizeof...(PosTs)>(state, std::index_sequence_for<VelTs...>{}), t, dt);
+                    return std::tuple_cat(nextPos, nextVel);
+                },
+                std::tuple_cat(pos, vel), std::index_sequence_for<PosTs..., VelTs...>{});
+    }
+} // namespace si
+
+#endif
@@ -0,0 +1,345 @@
+/**
+ * @file SiParser.hpp
+ * @author paul
+ * @date 17.10.26
+ * @brief Parsing of SI values from strings in the format produced by the printer (e.g. "10 m / s").
+ * @ingroup SI
+ */
+#ifndef SI_SIPARSER_HPP
+#define SI_SIPARSER_HPP
+
+#include <charconv>
+#include <cstddef>
+#include <limits>
+#include <string_view>
+#include <system_error>
+
+#include "SiBase.hpp"
+#include "SiExtended.hpp"
+#include "SiImpl.hpp"
+#include "SiPrinterExtended.hpp"
+#include "SiUnitString.hpp"
+
+/**
+ * Tokens for an entry of a unit list (see SI_BASE_UNITS): the name of the literals and the custom name of the unit
+ * (see SI_CUSTOM_UNIT_NAME), which is empty if there is none.
+ */
+#define SI_PARSER_UNIT_TOKENS(Name, literal, m, kg, s, A, K, Mol, CD) /* NOLINT(cppcoreguidelines-macro-usage) */      \
+    si::detail::UnitToken{#literal, {m, kg, s, A, K, Mol, CD}, true},                                                  \
+            si::detail::UnitToken{si::UnitName<m, kg, s, A, K, Mol, CD>::name, {m, kg, s, A, K, Mol, CD}, false},
+
+#ifndef SI_PARSER_UNITS
+/**
+ * Additional units which can be parsed in the format of SI_BASE_UNITS, can be defined before including SiParser.hpp
+ * to parse the names of units created outside of the library.
+ */
+    #define SI_PARSER_UNITS(X) /* NOLINT(cppcoreguidelines-macro-usage) */
+#endif
+
+namespace si {
+    namespace detail {
+        /**
+         * Name of a unit together with the exponents of the base units.
+         */
+        struct UnitToken {
+            std::string_view name;   ///< Name of the unit as written in the string
+            int exps[7];             ///< Exponents in the order of the template arguments of Si
+            bool prefixable = false; ///< The name can be preceded by a prefix (names of literals)
+        };
+
+        /**
+         * Create a token for a unit type.
+         * @tparam SiT the SI type
+         * @param name the name of the unit
+         * @return the token
+         */
+        template<typename SiT>
+        constexpr auto makeUnitToken(std::string_view name) -> UnitToken {
+            return UnitToken{name,
+                             {SiT::meter, SiT::kilogram, SiT::second, SiT::ampere, SiT::kelvin, SiT::mole,
+                              SiT::candela}};
+        }
+
+        /**
+         * Symbols of the base units as printed by unitToString.
+         */
+        constexpr UnitToken baseUnitTokens[] = {
+                makeUnitToken<Meter<>>("m"),    makeUnitToken<Kilogram<>>("kg"), makeUnitToken<Second<>>("s"),
+                makeUnitToken<Ampere<>>("A"),   makeUnitToken<Kelvin<>>("K"),    makeUnitToken<Mole<>>("Mol"),
+                makeUnitToken<Candela<>>("Cd"),
+        };
+
+        /**
+         * Names of the literals and custom names of all units known to the parser, created at compile time from the
+         * unit lists.
+         */
+        constexpr UnitToken unitTokens[] = {
+                SI_BASE_UNITS(SI_PARSER_UNIT_TOKENS) SI_EXTENDED_UNITS(SI_PARSER_UNIT_TOKENS)
+                        SI_PARSER_UNITS(SI_PARSER_UNIT_TOKENS)};
+
+        /**
+         * Unit prefix as used for the literals (see SI_CREATE_ALL_PREFIX).
+         */
+        struct PrefixToken {
+            std::string_view name; ///< Name of the prefix, e.g. "k" for kilo
+            int exp;               ///< Decimal exponent of the prefix
+        };
+
+        /**
+         * All unit prefixes, the prefix is separated from the name of the unit by an underscore (e.g. "k_meter").
+         */
+        constexpr PrefixToken prefixTokens[] = {
+                {"Y", 24}, {"Z", 21}, {"E", 18},  {"P", 15},  {"T", 12},  {"G", 9},    {"M", 6},
+                {"k", 3},  {"h", 2},  {"da", 1},  {"d", -1},  {"c", -2},  {"m", -3},   {"mu", -6},
+                {"n", -9}, {"p", -12}, {"f", -15}, {"a", -18}, {"z", -21}, {"y", -24},
+        };
+
+        /**
+         * Find a token by name.
+         * @tparam N the number of tokens
+         * @param tokens all tokens
+         * @param name the name to search
+         * @return pointer to the token or nullptr if there is no token with this name
+         */
+        template<typename Token, std::size_t N>
+        constexpr auto findToken(const Token (&tokens)[N], std::string_view name) -> const Token * {
+            for (const auto &token : tokens) {
+                if (token.name == name) {
+                    return &token;
+                }
+            }
+            return nullptr;
+        }
+
+        /**
+         * Result of parsing a single unit.
+         */
+        struct ParsedUnit {
+            const int *exps = nullptr; ///< Exponents of the unit, nullptr if the unit is unknown
+            int decimalExp = 0;        ///< Decimal exponent of the prefix
+        };
+
+        /**
+         * Find the name of a unit in unitTokens.
+         * @param name the name to search
+         * @param prefixed whether the name is preceded by a prefix, only names of literals can be prefixed
+         * @return pointer to the token or nullptr if the name is not known
+         */
+        constexpr auto findUnitName(std::string_view name, bool prefixed) -> const UnitToken * {
+            for (const auto &token : unitTokens) {
+                if (not token.name.empty() && token.name == name && (not prefixed || token.prefixable)) {
+                    return &token;
+                }
+            }
+            return nullptr;
+        }
+
+        /**
+         * Resolve the name of a single unit, this is either a symbol of a base unit, a custom name or the name of a
+         * literal with an optional prefix.
+         * @param name the name of the unit
+         * @return the exponents of the unit and the prefix
+         */
+        constexpr auto resolveUnit(std::string_view name) -> ParsedUnit {
+            if (const auto *token = findToken(baseUnitTokens, name)) {
+                return {token->exps, 0};
+            }
+            if (const auto *token = findUnitName(name, false)) {
+                return {token->exps, 0};
+            }
+            if (auto sep = name.find('_'); sep != std::string_view::npos) {
+                const auto *prefix = findToken(prefixTokens, name.substr(0, sep));
+                const auto *token = findUnitName(name.substr(sep + 1), true);
+                if (prefix != nullptr && token != nullptr) {
+                    return {token->exps, prefix->exp};
+                }
+            }
+            return {};
+        }
+
+        /**
+         * Calculate 10^exp.
+         * @param exp the exponent
+         * @return the power of ten
+         */
+        constexpr auto pow10(int exp) -> long double {
+            long double res = 1;
+            for (int i = 0; i < (exp < 0 ? -exp : exp); ++i) {
+                res *= 10;
+            }
+            return exp < 0 ? 1 / res : res;
+        }
+
+        /**
+         * Calculate 2^exp.
+         * @param exp the exponent, not negative
+         * @return the power of two
+         */
+        constexpr auto pow2(int exp) -> long double {
+            long double res = 1;
+            for (int i = 0; i < exp; ++i) {
+                res *= 2;
+            }
+            return res;
+        }
+
+        /**
+         * Checks whether a value can be converted to a type without overflow, for integer types the value is
+         * truncated.
+         * @tparam T the target type
+         * @param val the value
+         * @return true if the conversion is defined and does not overflow
+         */
+        template<typename T>
+        constexpr auto fitsInto(long double val) -> bool {
+            if constexpr (std::numeric_limits<T>::is_integer) {
+                // 2^digits is exact even if long double is the same as double (unlike the maximum of T)
+                constexpr auto bound = pow2(std::numeric_limits<T>::digits);
+                return val < bound && (std::numeric_limits<T>::is_signed ? val >= -bound : val > -1);
+            } else {
+                return val >= static_cast<long double>(std::numeric_limits<T>::lowest()) &&
+                       val <= static_cast<long double>(std::numeric_limits<T>::max());
+            }
+        }
+
+        /**
+         * Checks whether a character terminates the complete unit (i.e. no further unit can follow).
+         * @param c the character
+         * @return true if c is a separator or a line break
+         */
+        constexpr auto isSeparator(char c) -> bool {
+            return c == '\t' || c == '\n' || c == '\r' || c == ',' || c == ';';
+        }
+
+        /**
+         * Checks whether a character terminates the name of a unit.
+         * @param c the character
+         * @return true if c is a space, an exponent or a separator
+         */
+        constexpr auto isUnitDelimiter(char c) -> bool {
+            return c == ' ' || c == '^' || isSeparator(c);
+        }
+
+        /**
+         * Parse the unit part of a string, see from_chars for the format.
+         * @param first the begin of the unit part
+         * @param last the end of the string
+         * @param exps the summed exponents of all units
+         * @param decimalExp the summed decimal exponents of all prefixes
+         * @return pointer to the first character that is not part of the unit
+         */
+        constexpr auto parseUnit(const char *first, const char *last, int (&exps)[7], int &decimalExp) -> const char * {
+            const char *end = first;
+            bool inverse = false;
+            for (const char *it = first; it != last;) {
+                while (it != last && *it == ' ') {
+                    ++it;
+                }
+                const char *nameBegin = it;
+                while (it != last && not isUnitDelimiter(*it)) {
+                    ++it;
+                }
+                auto name = std::string_view{nameBegin, static_cast<std::size_t>(it - nameBegin)};
+                if (name.empty()) {
+                    break;
+                }
+                if (name == "/") {
+                    if (inverse) {
+                        break;
+                    }
+                    inverse = true;
+                    continue;
+                }
+                auto unit = resolveUnit(name);
+                if (unit.exps == nullptr) {
+                    break;
+                }
+                int exp = 1;
+                if (it != last && *it == '^') {
+                    auto [ptr, ec] = std::from_chars(it + 1, last, exp);
+                    if (ec != std::errc{}) {
+                        break;
+                    }
+                    it = ptr;
+                }
+                exp = inverse ? -exp : exp;
+                for (std::size_t i = 0; i < 7; ++i) {
+                    exps[i] += unit.exps[i] * exp;
+                }
+                decimalExp += unit.decimalExp * exp;
+                inverse = false;
+                end = it;
+            }
+            return end;
+        }
+    } // namespace detail
+
+    /**
+     * Parse an SI value from a string, this is the inverse of printing the value using operator<< and works like
+     * std::from_chars: no memory is allocated and the locale is ignored.
+     *
+     * The value is followed by a list of units separated by spaces, each unit can be followed by an exponent
+     * (e.g. "m^2") and can be preceded by "/ " to invert the unit. A unit is either the symbol of a base unit
+     * ("m", "kg", "s", "A", "K", "Mol", "Cd"), the name of the literals of a unit in SI_BASE_UNITS,
+     * SI_EXTENDED_UNITS or SI_PARSER_UNITS with an optional prefix (e.g. "meter", "k_meter" or "mu_second") or the
+     * custom name of one of these units (see SI_CUSTOM_UNIT_NAME, e.g. "V"). Prefixes are applied to the value.
+     * Examples are "10 m / s", "1 m^2 kg s^-3", "1 V", "2 V A" or "5 k_meter". All names are known at compile time,
+     * the string printed by operator<< for the type of value is always understood.
+     *
+     * @tparam m the meter exponent
+     * @tparam kg the kilogram exponent
+     * @tparam s the second exponent
+     * @tparam A the Ampere exponent
+     * @tparam K the Kelvin exponent
+     * @tparam MOL the Mol exponent
+     * @tparam CD the Candela exponent
+     * @tparam T the underlying numerical type
+     * @param first the begin of the string
+     * @param last the end of the string
+     * @param value the parsed value, only modified on success
+     * @return pointer to the first character that was not parsed and std::errc{} on success,
+     *      std::errc::invalid_argument if the string does not start with a number or the unit does not match
+     *      and std::errc::result_out_of_range if the value does not fit into T.
+     */
+    template<int m, int kg, int s, int A, int K, int MOL, int CD, typename T>
+    auto from_chars(const char *first, const char *last, // NOLINT(readability-identifier-naming) consistent with STL
+                    Si<m, kg, s, A, K, MOL, CD, T> &value) -> std::from_chars_result {
+        T raw{};
+        auto res = std::from_chars(first, last, raw);
+        if (res.ec != std::errc{}) {
+            return res;
+        }
+
+        // Fast path: the unit is exactly as printed by operator<<
+        constexpr auto printed = unitString<m, kg, s, A, K, MOL, CD>.view();
+        const auto rest = std::string_view{res.ptr, static_cast<std::size_t>(last - res.ptr)};
+        if (not printed.empty() && rest.substr(0, printed.size()) == printed &&
+            (rest.size() == printed.size() || detail::isSeparator(rest[printed.size()]))) {
+            value = Si<m, kg, s, A, K, MOL, CD, T>{raw};
+            return {res.ptr + printed.size(), std::errc{}};
+        }
+
+        int exps[7]{};
+        int decimalExp = 0;
+        const char *end = detail::parseUnit(res.ptr, last, exps, decimalExp);
+
+        const int expected[] = {m, kg, s, A, K, MOL, CD};
+        for (std::size_t i = 0; i < 7; ++i) {
+            if (exps[i] != expected[i]) {
+                return {first, std::errc::invalid_argument};
+            }
+        }
+
+        if (decimalExp != 0) {
+            const auto scaled = static_cast<long double>(raw) * detail::pow10(decimalExp);
+            if (not detail::fitsInto<T>(scaled)) {
+                return {first, std::errc::result_out_of_range};
+            }
+            raw = static_cast<T>(scaled);
+        }
+        value = Si<m, kg, s, A, K, MOL, CD, T>{raw};
+        return {end, std::errc{}};
+    }
+} // namespace si
+
+#endif
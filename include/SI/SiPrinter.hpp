@@ -2,7 +2,7 @@
  * @file SiPrinter.hpp
  * @author paul
  * @date 11.07.20
- * @brief Declaration of all functions related to printing Si instances together with their respective unit.
+ * @brief Definition of all functions related to printing Si instances together with their respective unit.
  * @ingroup SI
  */
 #ifndef SI_SIPRINTER_HPP
@@ -12,46 +12,12 @@
 #include <sstream>
 
 #include "SiImpl.hpp"
+#include "SiPrinterExtended.hpp"
+#include "SiUnitString.hpp"
 
 namespace si {
     /**
-     * Helper to print a single base unit with non trivial exponent.
-     * @tparam exp the exponent for the unit
-     * @param ostream the output stream to print to
-     * @param name the name of the unit
-     */
-    template<int exp>
-    void printHelper(std::ostream &ostream, const char *name) {
-        ostream << " " << name << "^" << exp;
-    }
-
-    /**
-     * Helper to print a single base unit with exponent 0 (i.e. not part of the compound unit).
-     * @see printHelper
-     */
-    template<>
-    void printHelper<0>(std::ostream & /*ostream*/, const char * /*name*/);
-
-    /**
-     * Helper to print a single base unit with exponent 1 (i.e. 1/[unit]).
-     * @see printHelper
-     * @param ostream the output stream to print to
-     * @param name the name of the unit
-     */
-    template<>
-    void printHelper<-1>(std::ostream &ostream, const char *name);
-
-    /**
-     * Helper to print a single base unit with exponent 1 (i.e. [unit]).
-     * @see printHelper
-     * @param ostream the output stream to print to
-     * @param name the name of the unit
-     */
-    template<>
-    void printHelper<1>(std::ostream &ostream, const char *name);
-
-    /**
-     * Helper function to convert a unit-type to a string
+     * Helper function to print the unit of a unit-type, the string is created at compile time (see unitString).
      * @tparam m the meter exponent
      * @tparam kg the kilogram exponent
      * @tparam s the second exponent
@@ -63,13 +29,8 @@ namespace si {
      */
     template<int m, int kg, int s, int A, int K, int MOL, int CD>
     void unitToString(std::ostream &ostream) {
-        printHelper<m>(ostream, "m");
-        printHelper<kg>(ostream, "kg");
-        printHelper<s>(ostream, "s");
-        printHelper<A>(ostream, "A");
-        printHelper<K>(ostream, "K");
-        printHelper<MOL>(ostream, "Mol");
-        printHelper<CD>(ostream, "Cd");
+        constexpr auto unit = unitString<m, kg, s, A, K, MOL, CD>.view();
+        ostream.write(unit.data(), static_cast<std::streamsize>(unit.size()));
     }
 
     /**
@@ -87,7 +48,7 @@ namespace si {
      */
     template<int m, int kg, int s, int A, int K, int MOL, int CD, typename T>
     std::ostream &operator<<(std::ostream &ostream, const Si<m, kg, s, A, K, MOL, CD, T> &si) {
-        auto val = static_cast<T>(si);
+        auto val = static_cast<typename ComputeType<T>::type>(si);
         ostream << val;
         unitToString<m, kg, s, A, K, MOL, CD>(ostream);
         return ostream;
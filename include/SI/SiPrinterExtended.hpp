@@ -2,7 +2,8 @@
  * @file SiPrinterExtended.hpp
  * @author paul
  * @date 14.07.20
- * @brief Header used for declaring specializations for pretty printing custom types.
+ * @brief Header used for registering the names for pretty printing custom types, it is included by all headers
+ * which print, format or parse units so the names are used consistently.
  * @ingroup SI
  */
 #ifndef SI_SIPRINTEREXTENDED_HPP
@@ -10,7 +11,8 @@
 
 #include "SiExtended.hpp"
 #include "SiPrinter.hpp"
+#include "SiUnitString.hpp"
 
-SI_CUSTOM_PRINTER_DEC(Volt)
+SI_CUSTOM_UNIT_NAME(Volt, "V")
 
 #endif
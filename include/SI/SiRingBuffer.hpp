@@ -0,0 +1,340 @@
+/**
+ * @file SiRingBuffer.hpp
+ * @author paul
+ * @date 17.10.26
+ * @brief Lock-free bounded queues for passing SI values between threads (single producer and multiple producer
+ * versions), batches are copied using memcpy. Requires C++20.
+ * @ingroup SI
+ */
+#ifndef SI_SIRINGBUFFER_HPP
+#define SI_SIRINGBUFFER_HPP
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstring>
+#include <optional>
+#include <span>
+#include <type_traits>
+
+namespace si {
+    namespace detail {
+        /**
+         * Assumed size of a cache line, indices written by different threads are placed on different cache lines.
+         * std::hardware_destructive_interference_size is not used as its value may differ between compilations.
+         */
+        constexpr std::size_t cacheLineSize = 64;
+
+        /**
+         * Storage of a ring buffer, batches are copied in at most two parts using memcpy.
+         * @tparam T the (trivially copyable) type of the values
+         * @tparam N the capacity, a power of two
+         */
+        template<typename T, std::size_t N>
+        class RingStorage {
+            static_assert(std::is_trivially_copyable_v<T>, "The values need to be trivially copyable");
+            static_assert(N >= 2 && (N & (N - 1)) == 0, "The capacity needs to be a power of two");
+
+          public:
+            static constexpr std::size_t mask = N - 1; ///< Maps positions to indices
+
+            /**
+             * Copy values into the buffer.
+             * @param pos the position of the first value
+             * @param in the values
+             * @param count the number of values, at most N
+             */
+            void write(std::size_t pos, const T *in, std::size_t count) noexcept {
+                auto idx = pos & mask;
+                auto first = count < N - idx ? count : N - idx;
+                std::memcpy(data_.data() + idx, in, first * sizeof(T));
+                std::memcpy(data_.data(), in + first, (count - first) * sizeof(T));
+            }
+
+            /**
+             * Copy values out of the buffer.
+             * @param pos the position of the first value
+             * @param out the values
+             * @param count the number of values, at most N
+             */
+            void read(std::size_t pos, T *out, std::size_t count) const noexcept {
+                auto idx = pos & mask;
+                auto first = count < N - idx ? count : N - idx;
+                std::memcpy(out, data_.data() + idx, first * sizeof(T));
+                std::memcpy(out + first, data_.data(), (count - first) * sizeof(T));
+            }
+
+            /**
+             * Access a single value.
+             * @param pos the position of the value
+             * @return the value
+             */
+            auto operator[](std::size_t pos) noexcept -> T & {
+                return data_[pos & mask];
+            }
+
+          private:
+            alignas(cacheLineSize) std::array<T, N> data_{};
+        };
+    } // namespace detail
+
+    /**
+     * Lock-free (and wait-free) ring buffer for one producer thread and one consumer thread. Head and tail are placed
+     * on separate cache lines, every thread additionally caches the index of the other thread so the shared cache
+     * lines are only read if the buffer seems to be full (or empty).
+     * @tparam SiT the type of the values, e.g. an SI type, needs to be trivially copyable
+     * @tparam N the capacity, needs to be a power of two
+     */
+    template<typename SiT, std::size_t N>
+    class RingBuffer {
+      public:
+        static constexpr std::size_t capacity = N; ///< Maximal number of values in the buffer
+
+        /**
+         * Add a value, may only be called by the producer thread.
+         * @param val the value
+         * @return false if the buffer is full
+         */
+        auto push(const SiT &val) noexcept -> bool {
+            auto tail = tail_.load(std::memory_order_relaxed);
+            if (tail - headCache_ == N) {
+                headCache_ = head_.load(std::memory_order_acquire);
+                if (tail - headCache_ == N) {
+                    return false;
+                }
+            }
+            storage_[tail] = val;
+            tail_.store(tail + 1, std::memory_order_release);
+            return true;
+        }
+
+        /**
+         * Add as many values as fit into the buffer, may only be called by the producer thread.
+         * @param vals the values
+         * @return the number of added values (the first values of vals)
+         */
+        auto push(std::span<const SiT> vals) noexcept -> std::size_t {
+            auto tail = tail_.load(std::memory_order_relaxed);
+            if (N - (tail - headCache_) < vals.size()) {
+                headCache_ = head_.load(std::memory_order_acquire);
+            }
+            auto free = N - (tail - headCache_);
+            auto count = free < vals.size() ? free : vals.size();
+            if (count == 0) {
+                return 0;
+            }
+            storage_.write(tail, vals.data(), count);
+            tail_.store(tail + count, std::memory_order_release);
+            return count;
+        }
+
+        /**
+         * Remove the oldest value, may only be called by the consumer thread.
+         * @return the value, std::nullopt if the buffer is empty
+         */
+        auto pop() noexcept -> std::optional<SiT> {
+            auto head = head_.load(std::memory_order_relaxed);
+            if (head == tailCache_) {
+                tailCache_ = tail_.load(std::memory_order_acquire);
+                if (head == tailCache_) {
+                    return std::nullopt;
+                }
+            }
+            SiT val = storage_[head];
+            head_.store(head + 1, std::memory_order_release);
+            return val;
+        }
+
+        /**
+         * Remove as many values as available and fit into out, may only be called by the consumer thread.
+         * @param out the removed values, oldest first
+         * @return the number of removed values
+         */
+        auto pop(std::span<SiT> out) noexcept -> std::size_t {
+            auto head = head_.load(std::memory_order_relaxed);
+            if (tailCache_ - head < out.size()) {
+                tailCache_ = tail_.load(std::memory_order_acquire);
+            }
+            auto available = tailCache_ - head;
+            auto count = available < out.size() ? available : out.size();
+            if (count == 0) {
+                return 0;
+            }
+            storage_.read(head, out.data(), count);
+            head_.store(head + count, std::memory_order_release);
+            return count;
+        }
+
+        /**
+         * Number of values in the buffer, only a snapshot if called while the other thread modifies the buffer.
+         * @return the number of values
+         */
+        [[nodiscard]] auto size() const noexcept -> std::size_t {
+            auto head = head_.load(std::memory_order_acquire);
+            return tail_.load(std::memory_order_acquire) - head;
+        }
+
+        /**
+         * Checks whether the buffer is empty, only a snapshot if called while the other thread modifies the buffer.
+         * @return true if there are no values in the buffer
+         */
+        [[nodiscard]] auto empty() const noexcept -> bool {
+            return size() == 0;
+        }
+
+      private:
+        alignas(detail::cacheLineSize) std::atomic<std::size_t> head_{0}; ///< Written by the consumer
+        std::size_t tailCache_{0};                                          ///< Consumer copy of tail_
+        alignas(detail::cacheLineSize) std::atomic<std::size_t> tail_{0}; ///< Written by the producer
+        std::size_t headCache_{0};                                          ///< Producer copy of head_
+        detail::RingStorage<SiT, N> storage_;
+    };
+
+    /**
+     * Lock-free ring buffer for multiple producer threads and one consumer thread (the bounded queue of D. Vyukov
+     * restricted to one consumer). Every slot has a sequence number which marks whether it is free or contains a
+     * value, producers reserve slots using compare and swap on the tail. The values are stored separately from the
+     * sequence numbers so batches can be copied using memcpy.
+     * @tparam SiT the type of the values, e.g. an SI type, needs to be trivially copyable
+     * @tparam N the capacity, needs to be a power of two
+     */
+    template<typename SiT, std::size_t N>
+    class MpscRingBuffer {
+      public:
+        static constexpr std::size_t capacity = N; ///< Maximal number of values in the buffer
+
+        /**
+         * Create an empty buffer.
+         */
+        MpscRingBuffer() noexcept {
+            for (std::size_t i = 0; i < N; ++i) {
+                sequence_[i].store(i, std::memory_order_relaxed);
+            }
+        }
+
+        /**
+         * Add a value, may be called by multiple threads at the same time.
+         * @param val the value
+         * @return false if the buffer is full
+         */
+        auto push(const SiT &val) noexcept -> bool {
+            auto pos = tail_.load(std::memory_order_relaxed);
+            while (true) {
+                auto seq = sequence_[pos & mask].load(std::memory_order_acquire);
+                auto diff = static_cast<std::ptrdiff_t>(seq - pos);
+                if (diff == 0) {
+                    if (tail_.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) {
+                        break;
+                    }
+                } else if (diff < 0) {
+                    return false; // The slot still contains the value of the previous round
+                } else {
+                    pos = tail_.load(std::memory_order_relaxed);
+                }
+            }
+            storage_[pos] = val;
+            sequence_[pos & mask].store(pos + 1, std::memory_order_release);
+            return true;
+        }
+
+        /**
+         * Add as many values as fit into the buffer, may be called by multiple threads at the same time. The values
+         * are added as one contiguous block, values of other producers are not interleaved.
+         * @param vals the values
+         * @return the number of added values (the first values of vals)
+         */
+        auto push(std::span<const SiT> vals) noexcept -> std::size_t {
+            auto pos = tail_.load(std::memory_order_relaxed);
+            std::size_t count = 0;
+            while (true) {
+                // All slots before head (plus one round) have been released by the consumer
+                auto used = static_cast<std::ptrdiff_t>(pos - head_.load(std::memory_order_acquire));
+                if (used < 0) { // pos is outdated
+                    pos = tail_.load(std::memory_order_relaxed);
+                    continue;
+                }
+                // Single pushes may already use slots which are released but not yet reflected in head
+                auto free = static_cast<std::size_t>(used) < N ? N - static_cast<std::size_t>(used) : 0;
+                count = free < vals.size() ? free : vals.size();
+                if (count == 0) {
+                    return 0;
+                }
+                if (tail_.compare_exchange_weak(pos, pos + count, std::memory_order_relaxed)) {
+                    break;
+                }
+            }
+            storage_.write(pos, vals.data(), count);
+            for (std::size_t i = 0; i < count; ++i) {
+                sequence_[(pos + i) & mask].store(pos + i + 1, std::memory_order_release);
+            }
+            return count;
+        }
+
+        /**
+         * Remove the oldest value, may only be called by the consumer thread.
+         * @return the value, std::nullopt if the buffer is empty (or the oldest value is not completely written yet)
+         */
+        auto pop() noexcept -> std::optional<SiT> {
+            auto head = head_.load(std::memory_order_relaxed);
+            if (sequence_[head & mask].load(std::memory_order_acquire) != head + 1) {
+                return std::nullopt;
+            }
+            SiT val = storage_[head];
+            sequence_[head & mask].store(head + N, std::memory_order_release);
+            head_.store(head + 1, std::memory_order_release);
+            return val;
+        }
+
+        /**
+         * Remove as many completely written values as available and fit into out, may only be called by the
+         * consumer thread.
+         * @param out the removed values, oldest first
+         * @return the number of removed values
+         */
+        auto pop(std::span<SiT> out) noexcept -> std::size_t {
+            auto head = head_.load(std::memory_order_relaxed);
+            std::size_t count = 0;
+            while (count < out.size() &&
+                   sequence_[(head + count) & mask].load(std::memory_order_acquire) == head + count + 1) {
+                ++count;
+            }
+            if (count == 0) {
+                return 0;
+            }
+            storage_.read(head, out.data(), count);
+            for (std::size_t i = 0; i < count; ++i) {
+                sequence_[(head + i) & mask].store(head + i + N, std::memory_order_release);
+            }
+            head_.store(head + count, std::memory_order_release);
+            return count;
+        }
+
+        /**
+         * Number of values in the buffer (including reserved slots which are still written), only a snapshot if
+         * called while other threads modify the buffer.
+         * @return the number of values
+         */
+        [[nodiscard]] auto size() const noexcept -> std::size_t {
+            auto head = head_.load(std::memory_order_acquire);
+            return tail_.load(std::memory_order_acquire) - head;
+        }
+
+        /**
+         * Checks whether the buffer is empty, only a snapshot if called while other threads modify the buffer.
+         * @return true if there are no values in the buffer
+         */
+        [[nodiscard]] auto empty() const noexcept -> bool {
+            return size() == 0;
+        }
+
+      private:
+        static constexpr std::size_t mask = N - 1;
+
+        alignas(detail::cacheLineSize) std::atomic<std::size_t> tail_{0}; ///< Written by the producers
+        alignas(detail::cacheLineSize) std::atomic<std::size_t> head_{0}; ///< Written by the consumer
+        alignas(detail::cacheLineSize) std::array<std::atomic<std::size_t>, N> sequence_;
+        detail::RingStorage<SiT, N> storage_;
+    };
+} // namespace si
+
+#endif
@@ -0,0 +1,569 @@
+/**
+ * @file SiScaled.hpp
+ * @author paul
+ * @date 17.10.26
+ * @brief SI values with a compile time scale (e.g. millimeters stored as integer), modeled after std::chrono::duration.
+ * @ingroup SI
+ */
+#ifndef SI_SISCALED_HPP
+#define SI_SISCALED_HPP
+
+#include <cstdint>
+#include <functional>
+#include <numeric>
+#include <ratio>
+#include <type_traits>
+
+#include "SiImpl.hpp"
+
+namespace si {
+    template<typename SiT, typename Ratio>
+    class Scaled;
+
+    /**
+     * Type trait to check whether a type is a scaled SI type.
+     * @tparam T the type to check
+     */
+    template<typename T>
+    struct IsScaled {
+        /**
+         * Type is not a scaled SI type.
+         */
+        static constexpr auto val = false;
+    };
+
+    /**
+     * Specialization of type trait to check whether a type is a scaled SI type for scaled SI types.
+     * @tparam SiT the SI type
+     * @tparam Ratio the scale
+     */
+    template<typename SiT, typename Ratio>
+    struct IsScaled<Scaled<SiT, Ratio>> {
+        /**
+         * Type is a scaled SI type.
+         */
+        static constexpr auto val = true;
+    };
+
+    namespace detail {
+        /**
+         * Largest ratio such that both ratios are integer multiples of it (as std::common_type for durations).
+         */
+        template<typename R1, typename R2>
+        using CommonRatio = std::ratio<std::gcd(R1::num, R2::num), std::lcm(R1::den, R2::den)>;
+
+        /**
+         * Checks whether a value with scale From can be converted to scale To without loss.
+         */
+        template<typename From, typename To, typename Rep>
+        constexpr auto isLossless = std::is_floating_point_v<Rep> || std::ratio_divide<From, To>::den == 1;
+
+        /**
+         * Convert a count between scales, the factor is folded at compile time (as std::chrono::duration_cast).
+         * @tparam From the scale of the count
+         * @tparam To the scale of the result
+         * @tparam ToRep the type of the result
+         * @tparam FromRep the type of the count
+         * @param count the value in scale From
+         * @return the value in scale To, truncated towards zero for integer types
+         */
+        template<typename From, typename To, typename ToRep, typename FromRep>
+        constexpr auto rescale(FromRep count) -> ToRep {
+            using Factor = std::ratio_divide<From, To>;
+            using Common = std::common_type_t<ToRep, FromRep, std::intmax_t>;
+            if constexpr (Factor::num == 1 && Factor::den == 1) {
+                return static_cast<ToRep>(count);
+            } else if constexpr (Factor::den == 1) {
+                return static_cast<ToRep>(static_cast<Common>(count) * static_cast<Common>(Factor::num));
+            } else if constexpr (Factor::num == 1) {
+                return static_cast<ToRep>(static_cast<Common>(count) / static_cast<Common>(Factor::den));
+            } else {
+                return static_cast<ToRep>(static_cast<Common>(count) * static_cast<Common>(Factor::num) /
+                                          static_cast<Common>(Factor::den));
+            }
+        }
+    } // namespace detail
+
+    /**
+     * SI value which is stored as integer multiple of a compile time scale, e.g. Scaled<Meter<int32_t>, std::milli>
+     * stores millimeters as int32_t. This works like std::chrono::duration: conversions between scales are implicit if
+     * they are lossless, addition and subtraction of values with different scales use the common scale and products
+     * and quotients multiply and divide the scales. All scale factors are folded at compile time.
+     * @tparam SiT the SI type (unit and underlying type) of the value
+     * @tparam Ratio the scale as std::ratio
+     */
+    template<typename SiT, typename Ratio = std::ratio<1>>
+    class Scaled {
+        static_assert(IsSi<SiT>::val, "Scaled requires an SI type");
+        static_assert(Ratio::num > 0, "Scale needs to be positive");
+
+      public:
+        using unit = SiT;                   ///< The SI type with scale one
+        using rep = typename SiT::type;     ///< The underlying numerical type
+        using ratio = typename Ratio::type; ///< The scale
+
+        /**
+         * Create a scaled value of zero.
+         */
+        constexpr Scaled() noexcept = default;
+
+        /**
+         * Create a scaled value from the number of steps of the scale.
+         * @param count the value in units of the scale
+         */
+        constexpr explicit Scaled(rep count) noexcept : count_{count} {
+        }
+
+        /**
+         * Convert from a value with another scale, only available if the conversion is lossless.
+         * @tparam SiT_ the SI type of the other value, needs to have the same unit
+         * @tparam Ratio_ the scale of the other value
+         * @param other the other value
+         */
+        template<typename SiT_, typename Ratio_,
+                 std::enable_if_t<std::is_same_v<typename detail::Rebind<SiT_, rep>::type, SiT> &&
+                                          detail::isLossless<Ratio_, ratio, rep> &&
+                                          (std::is_floating_point_v<rep> ||
+                                           not std::is_floating_point_v<typename SiT_::type>),
+                                  bool> = true>
+        constexpr Scaled(Scaled<SiT_, Ratio_> other) noexcept /* NOLINT(google-explicit-constructor) */ :
+            count_{detail::rescale<Ratio_, ratio, rep>(other.count())} {
+        }
+
+        /**
+         * Convert from an SI value, only available if the conversion is lossless.
+         * @tparam Dummy dummy type for SFINAE
+         * @param si the SI value
+         */
+        template<typename Dummy = SiT, std::enable_if_t<detail::isLossless<std::ratio<1>, Ratio, rep> &&
+                                                                std::is_same_v<Dummy, SiT>,
+                                                        bool> = true>
+        constexpr Scaled(SiT si) noexcept /* NOLINT(google-explicit-constructor) */ :
+            count_{detail::rescale<std::ratio<1>, ratio, rep>(static_cast<rep>(si))} {
+        }
+
+        /**
+         * Number of steps of the scale.
+         * @return the value in units of the scale
+         */
+        [[nodiscard]] constexpr auto count() const noexcept -> rep {
+            return count_;
+        }
+
+        /**
+         * Convert to an SI value with scale one, for integer types the value is truncated if the scale is not an
+         * integer.
+         * @return the value as SI value
+         */
+        [[nodiscard]] constexpr auto si() const noexcept -> SiT {
+            return SiT{detail::rescale<ratio, std::ratio<1>, rep>(count_)};
+        }
+
+        /**
+         * Negation.
+         * @return the negated value
+         */
+        constexpr auto operator-() const noexcept -> Scaled {
+            return Scaled{static_cast<rep>(-count_)};
+        }
+
+        /**
+         * Add a value, values with another scale are converted if this is lossless.
+         * @param rhs the other summand
+         * @return reference to this
+         */
+        constexpr auto operator+=(Scaled rhs) noexcept -> Scaled & {
+            count_ += rhs.count_;
+            return *this;
+        }
+
+        /**
+         * Subtract a value, values with another scale are converted if this is lossless.
+         * @param rhs the subtrahend
+         * @return reference to this
+         */
+        constexpr auto operator-=(Scaled rhs) noexcept -> Scaled & {
+            count_ -= rhs.count_;
+            return *this;
+        }
+
+        /**
+         * Multiply with a scalar.
+         * @param rhs the scalar
+         * @return reference to this
+         */
+        constexpr auto operator*=(rep rhs) noexcept -> Scaled & {
+            count_ *= rhs;
+            return *this;
+        }
+
+        /**
+         * Divide by a scalar.
+         * @param rhs the scalar
+         * @return reference to this
+         */
+        constexpr auto operator/=(rep rhs) noexcept -> Scaled & {
+            count_ /= rhs;
+            return *this;
+        }
+
+      private:
+        rep count_{};
+    };
+
+    /**
+     * Convert a scaled value to another scale and/or underlying type, the conversion is explicit and may be lossy
+     * (integer results are truncated towards zero).
+     * @tparam To the scaled type of the result
+     * @tparam SiT the SI type of the value
+     * @tparam Ratio the scale of the value
+     * @param from the value
+     * @return the value in the scale of To
+     */
+    template<typename To, typename SiT, typename Ratio>
+    constexpr auto scaleCast(Scaled<SiT, Ratio> from) noexcept -> To {
+        static_assert(IsScaled<To>::val, "scaleCast requires a scaled type as result");
+        static_assert(std::is_same_v<typename detail::Rebind<SiT, typename To::rep>::type, typename To::unit>,
+                      "scaleCast can not change the unit");
+        return To{detail::rescale<Ratio, typename To::ratio, typename To::rep>(from.count())};
+    }
+
+    namespace detail {
+        /**
+         * Type of the sum of two scaled values: the common scale and the common underlying type.
+         */
+        template<typename SiT1, typename Ratio1, typename SiT2, typename Ratio2>
+        using ScaledSum = Scaled<typename Rebind<SiT1, std::common_type_t<typename SiT1::type, typename SiT2::type>>::type,
+                                 CommonRatio<Ratio1, Ratio2>>;
+
+        /**
+         * Type of the product of two scaled values: the product of the units and of the scales.
+         */
+        template<typename SiT1, typename Ratio1, typename SiT2, typename Ratio2>
+        using ScaledProduct = Scaled<
+                typename Rebind<decltype(std::declval<typename Rebind<SiT1, double>::type>() *
+                                         std::declval<typename Rebind<SiT2, double>::type>()),
+                                std::common_type_t<typename SiT1::type, typename SiT2::type>>::type,
+                std::ratio_multiply<Ratio1, Ratio2>>;
+
+        /**
+         * Type of the quotient of two scaled values: the quotient of the units and of the scales.
+         */
+        template<typename SiT1, typename Ratio1, typename SiT2, typename Ratio2>
+        using ScaledQuotient = Scaled<
+                typename Rebind<decltype(std::declval<typename Rebind<SiT1, double>::type>() /
+                                         std::declval<typename Rebind<SiT2, double>::type>()),
+                                std::common_type_t<typename SiT1::type, typename SiT2::type>>::type,
+                std::ratio_divide<Ratio1, Ratio2>>;
+    } // namespace detail
+
+    /**
+     * Addition of scaled values, the result has the common scale of both values (i.e. both are converted without loss).
+     * @tparam SiT1 the SI type of the first summand
+     * @tparam Ratio1 the scale of the first summand
+     * @tparam SiT2 the SI type of the second summand, needs to have the same unit
+     * @tparam Ratio2 the scale of the second summand
+     * @param lhs the first summand
+     * @param rhs the second summand
+     * @return the sum in the common scale
+     */
+    template<typename SiT1, typename Ratio1, typename SiT2, typename Ratio2>
+    constexpr auto operator+(Scaled<SiT1, Ratio1> lhs, Scaled<SiT2, Ratio2> rhs) noexcept
+            -> detail::ScaledSum<SiT1, Ratio1, SiT2, Ratio2> {
+        using Res = detail::ScaledSum<SiT1, Ratio1, SiT2, Ratio2>;
+        return Res{static_cast<typename Res::rep>(Res{lhs}.count() + Res{rhs}.count())};
+    }
+
+    /**
+     * Subtraction of scaled values, the result has the common scale of both values.
+     * @tparam SiT1 the SI type of the minuend
+     * @tparam Ratio1 the scale of the minuend
+     * @tparam SiT2 the SI type of the subtrahend, needs to have the same unit
+     * @tparam Ratio2 the scale of the subtrahend
+     * @param lhs the minuend
+     * @param rhs the subtrahend
+     * @return the difference in the common scale
+     */
+    template<typename SiT1, typename Ratio1, typename SiT2, typename Ratio2>
+    constexpr auto operator-(Scaled<SiT1, Ratio1> lhs, Scaled<SiT2, Ratio2> rhs) noexcept
+            -> detail::ScaledSum<SiT1, Ratio1, SiT2, Ratio2> {
+        using Res = detail::ScaledSum<SiT1, Ratio1, SiT2, Ratio2>;
+        return Res{static_cast<typename Res::rep>(Res{lhs}.count() - Res{rhs}.count())};
+    }
+
+    /**
+     * Multiplication of scaled values, the counts are multiplied and the result has the product of both scales.
+     * @tparam SiT1 the SI type of the first factor
+     * @tparam Ratio1 the scale of the first factor
+     * @tparam SiT2 the SI type of the second factor
+     * @tparam Ratio2 the scale of the second factor
+     * @param lhs the first factor
+     * @param rhs the second factor
+     * @return the product
+     */
+    template<typename SiT1, typename Ratio1, typename SiT2, typename Ratio2>
+    constexpr auto operator*(Scaled<SiT1, Ratio1> lhs, Scaled<SiT2, Ratio2> rhs) noexcept
+            -> detail::ScaledProduct<SiT1, Ratio1, SiT2, Ratio2> {
+        using Res = detail::ScaledProduct<SiT1, Ratio1, SiT2, Ratio2>;
+        return Res{static_cast<typename Res::rep>(lhs.count() * rhs.count())};
+    }
+
+    /**
+     * Division of scaled values, the counts are divided and the result has the quotient of both scales.
+     * @tparam SiT1 the SI type of the dividend
+     * @tparam Ratio1 the scale of the dividend
+     * @tparam SiT2 the SI type of the divisor
+     * @tparam Ratio2 the scale of the divisor
+     * @param lhs the dividend
+     * @param rhs the divisor
+     * @return the quotient
+     */
+    template<typename SiT1, typename Ratio1, typename SiT2, typename Ratio2>
+    constexpr auto operator/(Scaled<SiT1, Ratio1> lhs, Scaled<SiT2, Ratio2> rhs) noexcept
+            -> detail::ScaledQuotient<SiT1, Ratio1, SiT2, Ratio2> {
+        using Res = detail::ScaledQuotient<SiT1, Ratio1, SiT2, Ratio2>;
+        return Res{static_cast<typename Res::rep>(lhs.count() / rhs.count())};
+    }
+
+    /**
+     * Multiplication with a scalar.
+     * @tparam SiT the SI type of the value
+     * @tparam Ratio the scale of the value
+     * @param lhs the value
+     * @param rhs the scalar
+     * @return the scaled value
+     */
+    template<typename SiT, typename Ratio>
+    constexpr auto operator*(Scaled<SiT, Ratio> lhs, typename SiT::type rhs) noexcept -> Scaled<SiT, Ratio> {
+        return Scaled<SiT, Ratio>{static_cast<typename SiT::type>(lhs.count() * rhs)};
+    }
+
+    /**
+     * Multiplication with a scalar.
+     * @tparam SiT the SI type of the value
+     * @tparam Ratio the scale of the value
+     * @param lhs the scalar
+     * @param rhs the value
+     * @return the scaled value
+     */
+    template<typename SiT, typename Ratio>
+    constexpr auto operator*(typename SiT::type lhs, Scaled<SiT, Ratio> rhs) noexcept -> Scaled<SiT, Ratio> {
+        return rhs * lhs;
+    }
+
+    /**
+     * Division by a scalar.
+     * @tparam SiT the SI type of the value
+     * @tparam Ratio the scale of the value
+     * @param lhs the value
+     * @param rhs the scalar
+     * @return the scaled value
+     */
+    template<typename SiT, typename Ratio>
+    constexpr auto operator/(Scaled<SiT, Ratio> lhs, typename SiT::type rhs) noexcept -> Scaled<SiT, Ratio> {
+        return Scaled<SiT, Ratio>{static_cast<typename SiT::type>(lhs.count() / rhs)};
+    }
+
+    namespace detail {
+        /**
+         * Compare two scaled values in their common scale.
+         * @tparam Compare the comparison functor
+         * @param lhs the first value
+         * @param rhs the second value
+         * @return the result of the comparison
+         */
+        template<typename Compare, typename SiT1, typename Ratio1, typename SiT2, typename Ratio2>
+        constexpr auto compareScaled(Scaled<SiT1, Ratio1> lhs, Scaled<SiT2, Ratio2> rhs) noexcept -> bool {
+            using Common = ScaledSum<SiT1, Ratio1, SiT2, Ratio2>;
+            return Compare{}(Common{lhs}.count(), Common{rhs}.count());
+        }
+    } // namespace detail
+
+    /**
+     * Equality of scaled values with the same unit, compared in the common scale.
+     * @tparam SiT1 the SI type of the first value
+     * @tparam Ratio1 the scale of the first value
+     * @tparam SiT2 the SI type of the second value, needs to have the same unit
+     * @tparam Ratio2 the scale of the second value
+     * @param lhs the first value
+     * @param rhs the second value
+     * @return true if the values are equal
+     */
+    template<typename SiT1, typename Ratio1, typename SiT2, typename Ratio2>
+    constexpr auto operator==(Scaled<SiT1, Ratio1> lhs, Scaled<SiT2, Ratio2> rhs) noexcept -> bool {
+        return detail::compareScaled<std::equal_to<>>(lhs, rhs);
+    }
+
+    /**
+     * Non-Equality of scaled values with the same unit, compared in the common scale.
+     * @tparam SiT1 the SI type of the first value
+     * @tparam Ratio1 the scale of the first value
+     * @tparam SiT2 the SI type of the second value, needs to have the same unit
+     * @tparam Ratio2 the scale of the second value
+     * @param lhs the first value
+     * @param rhs the second value
+     * @return true if the values are not equal
+     */
+    template<typename SiT1, typename Ratio1, typename SiT2, typename Ratio2>
+    constexpr auto operator!=(Scaled<SiT1, Ratio1> lhs, Scaled<SiT2, Ratio2> rhs) noexcept -> bool {
+        return detail::compareScaled<std::not_equal_to<>>(lhs, rhs);
+    }
+
+    /**
+     * Less than operator for scaled values with the same unit, compared in the common scale.
+     * @tparam SiT1 the SI type of the first value
+     * @tparam Ratio1 the scale of the first value
+     * @tparam SiT2 the SI type of the second value, needs to have the same unit
+     * @tparam Ratio2 the scale of the second value
+     * @param lhs the first value
+     * @param rhs the second value
+     * @return true if lhs is less than rhs
+     */
+    template<typename SiT1, typename Ratio1, typename SiT2, typename Ratio2>
+    constexpr auto operator<(Scaled<SiT1, Ratio1> lhs, Scaled<SiT2, Ratio2> rhs) noexcept -> bool {
+        return detail::compareScaled<std::less<>>(lhs, rhs);
+    }
+
+    /**
+     * Greater than operator for scaled values with the same unit, compared in the common scale.
+     * @tparam SiT1 the SI type of the first value
+     * @tparam Ratio1 the scale of the first value
+     * @tparam SiT2 the SI type of the second value, needs to have the same unit
+     * @tparam Ratio2 the scale of the second value
+     * @param lhs the first value
+     * @param rhs the second value
+     * @return true if lhs is greater than rhs
+     */
+    template<typename SiT1, typename Ratio1, typename SiT2, typename Ratio2>
+    constexpr auto operator>(Scaled<SiT1, Ratio1> lhs, Scaled<SiT2, Ratio2> rhs) noexcept -> bool {
+        return detail::compareScaled<std::greater<>>(lhs, rhs);
+    }
+
+    /**
+     * Less than-equal operator for scaled values with the same unit, compared in the common scale.
+     * @tparam SiT1 the SI type of the first value
+     * @tparam Ratio1 the scale of the first value
+     * @tparam SiT2 the SI type of the second value, needs to have the same unit
+     * @tparam Ratio2 the scale of the second value
+     * @param lhs the first value
+     * @param rhs the second value
+     * @return true if lhs is less or equal than rhs
+     */
+    template<typename SiT1, typename Ratio1, typename SiT2, typename Ratio2>
+    constexpr auto operator<=(Scaled<SiT1, Ratio1> lhs, Scaled<SiT2, Ratio2> rhs) noexcept -> bool {
+        return detail::compareScaled<std::less_equal<>>(lhs, rhs);
+    }
+
+    /**
+     * Greater than-equal operator for scaled values with the same unit, compared in the common scale.
+     * @tparam SiT1 the SI type of the first value
+     * @tparam Ratio1 the scale of the first value
+     * @tparam SiT2 the SI type of the second value, needs to have the same unit
+     * @tparam Ratio2 the scale of the second value
+     * @param lhs the first value
+     * @param rhs the second value
+     * @return true if lhs is greater or equal than rhs
+     */
+    template<typename SiT1, typename Ratio1, typename SiT2, typename Ratio2>
+    constexpr auto operator>=(Scaled<SiT1, Ratio1> lhs, Scaled<SiT2, Ratio2> rhs) noexcept -> bool {
+        return detail::compareScaled<std::greater_equal<>>(lhs, rhs);
+    }
+
+    /**
+     * Unit with scale 10^-18, e.g. Atto<Meter, std::int64_t>.
+     */
+    template<template<typename> typename Unit, typename T = default_type>
+    using Atto = Scaled<Unit<T>, std::atto>;
+
+    /**
+     * Unit with scale 10^-15.
+     */
+    template<template<typename> typename Unit, typename T = default_type>
+    using Femto = Scaled<Unit<T>, std::femto>;
+
+    /**
+     * Unit with scale 10^-12.
+     */
+    template<template<typename> typename Unit, typename T = default_type>
+    using Pico = Scaled<Unit<T>, std::pico>;
+
+    /**
+     * Unit with scale 10^-9.
+     */
+    template<template<typename> typename Unit, typename T = default_type>
+    using Nano = Scaled<Unit<T>, std::nano>;
+
+    /**
+     * Unit with scale 10^-6.
+     */
+    template<template<typename> typename Unit, typename T = default_type>
+    using Micro = Scaled<Unit<T>, std::micro>;
+
+    /**
+     * Unit with scale 10^-3.
+     */
+    template<template<typename> typename Unit, typename T = default_type>
+    using Milli = Scaled<Unit<T>, std::milli>;
+
+    /**
+     * Unit with scale 10^-2.
+     */
+    template<template<typename> typename Unit, typename T = default_type>
+    using Centi = Scaled<Unit<T>, std::centi>;
+
+    /**
+     * Unit with scale 10^-1.
+     */
+    template<template<typename> typename Unit, typename T = default_type>
+    using Deci = Scaled<Unit<T>, std::deci>;
+
+    /**
+     * Unit with scale 10^1.
+     */
+    template<template<typename> typename Unit, typename T = default_type>
+    using Deca = Scaled<Unit<T>, std::deca>;
+
+    /**
+     * Unit with scale 10^2.
+     */
+    template<template<typename> typename Unit, typename T = default_type>
+    using Hecto = Scaled<Unit<T>, std::hecto>;
+
+    /**
+     * Unit with scale 10^3.
+     */
+    template<template<typename> typename Unit, typename T = default_type>
+    using Kilo = Scaled<Unit<T>, std::kilo>;
+
+    /**
+     * Unit with scale 10^6.
+     */
+    template<template<typename> typename Unit, typename T = default_type>
+    using Mega = Scaled<Unit<T>, std::mega>;
+
+    /**
+     * Unit with scale 10^9.
+     */
+    template<template<typename> typename Unit, typename T = default_type>
+    using Giga = Scaled<Unit<T>, std::giga>;
+
+    /**
+     * Unit with scale 10^12.
+     */
+    template<template<typename> typename Unit, typename T = default_type>
+    using Tera = Scaled<Unit<T>, std::tera>;
+
+    /**
+     * Unit with scale 10^15.
+     */
+    template<template<typename> typename Unit, typename T = default_type>
+    using Peta = Scaled<Unit<T>, std::peta>;
+
+    /**
+     * Unit with scale 10^18.
+     */
+    template<template<typename> typename Unit, typename T = default_type>
+    using Exa = Scaled<Unit<T>, std::exa>;
+} // namespace si
+
+#endif
@@ -0,0 +1,159 @@
+/**
+ * @file SiSpan.hpp
+ * @author paul
+ * @date 17.10.26
+ * @brief Zero-copy conversion between spans of SI values and spans of the underlying type or bytes, bulk conversion
+ * between underlying types. Requires C++20.
+ * @ingroup SI
+ */
+#ifndef SI_SISPAN_HPP
+#define SI_SISPAN_HPP
+
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <type_traits>
+
+#include "SiImpl.hpp"
+
+namespace si {
+    namespace detail {
+        /**
+         * Apply the const qualifier of From to To.
+         */
+        template<typename From, typename To>
+        using CopyConst = std::conditional_t<std::is_const_v<From>, const To, To>;
+
+        /**
+         * Extent of a span after reinterpreting the elements as bytes.
+         */
+        template<typename T, std::size_t Extent>
+        constexpr std::size_t byteExtent = Extent == std::dynamic_extent ? std::dynamic_extent : Extent * sizeof(T);
+
+        /**
+         * Conversion of many values of the underlying type From to To, used by convertPrecision. Specialized for
+         * types which require explicit vector instructions.
+         * @tparam From the type to convert from
+         * @tparam To the type to convert to
+         */
+        template<typename From, typename To>
+        struct BulkConversion {
+            /**
+             * Convert all values by casting them.
+             * @param in the values to convert
+             * @param out the converted values
+             * @param size the number of values
+             */
+            static void convert(const From *in, To *out, std::size_t size) noexcept {
+                for (std::size_t i = 0; i < size; ++i) {
+                    out[i] = static_cast<To>(in[i]);
+                }
+            }
+        };
+    } // namespace detail
+
+    /**
+     * Reinterpret a span of SI values as span of the underlying type, no values are copied.
+     * @tparam SiT the (possibly const) SI type
+     * @tparam Extent the extent of the span
+     * @param span the SI values
+     * @return a span of the underlying values referencing the same memory
+     */
+    template<typename SiT, std::size_t Extent>
+    auto asRaw(std::span<SiT, Extent> span) noexcept
+            -> std::span<detail::CopyConst<SiT, typename std::remove_const_t<SiT>::type>, Extent> {
+        using RawT = detail::CopyConst<SiT, typename std::remove_const_t<SiT>::type>;
+        static_assert(IsSi<std::remove_const_t<SiT>>::val, "asRaw requires a span of SI values");
+        static_assert(hasRawLayout<std::remove_const_t<SiT>>, "SI type does not have the layout of its underlying type");
+        // NOLINTNEXTLINE(cppcoreguidelines-pro-type-reinterpret-cast) layout is guaranteed by hasRawLayout
+        return std::span<RawT, Extent>{reinterpret_cast<RawT *>(span.data()), span.size()};
+    }
+
+    /**
+     * Reinterpret a span of the underlying type as span of SI values, no values are copied.
+     * @tparam SiT the SI type of the result
+     * @tparam T the (possibly const) underlying type, needs to be the underlying type of SiT
+     * @tparam Extent the extent of the span
+     * @param span the underlying values
+     * @return a span of SI values referencing the same memory
+     */
+    template<typename SiT, typename T, std::size_t Extent>
+    auto asSi(std::span<T, Extent> span) noexcept -> std::span<detail::CopyConst<T, SiT>, Extent> {
+        using SiRes = detail::CopyConst<T, SiT>;
+        static_assert(IsSi<SiT>::val, "asSi requires an SI type as result");
+        static_assert(std::is_same_v<std::remove_const_t<T>, typename SiT::type>,
+                      "The span is not of the underlying type of the SI type");
+        static_assert(hasRawLayout<SiT>, "SI type does not have the layout of its underlying type");
+        // NOLINTNEXTLINE(cppcoreguidelines-pro-type-reinterpret-cast) layout is guaranteed by hasRawLayout
+        return std::span<SiRes, Extent>{reinterpret_cast<SiRes *>(span.data()), span.size()};
+    }
+
+    /**
+     * Reinterpret a span of SI values as read-only bytes (for example for sending them), no values are copied.
+     * @tparam SiT the (possibly const) SI type
+     * @tparam Extent the extent of the span
+     * @param span the SI values
+     * @return the object representation of the values
+     */
+    template<typename SiT, std::size_t Extent>
+    auto asBytes(std::span<SiT, Extent> span) noexcept
+            -> std::span<const std::byte, detail::byteExtent<SiT, Extent>> {
+        return std::as_bytes(asRaw(span));
+    }
+
+    /**
+     * Reinterpret a span of SI values as writable bytes (for example for receiving them), no values are copied.
+     * @tparam SiT the SI type
+     * @tparam Extent the extent of the span
+     * @param span the SI values
+     * @return the object representation of the values
+     */
+    template<typename SiT, std::size_t Extent>
+    auto asWritableBytes(std::span<SiT, Extent> span) noexcept
+            -> std::span<std::byte, detail::byteExtent<SiT, Extent>> {
+        return std::as_writable_bytes(asRaw(span));
+    }
+
+    /**
+     * Reinterpret bytes (for example of a received message) as span of SI values, no values are copied. The bytes
+     * need to be suitably aligned for the underlying type and their number needs to be a multiple of its size.
+     * @tparam SiT the SI type of the result
+     * @tparam Byte std::byte or const std::byte
+     * @param bytes the object representation of the values
+     * @return a span of SI values referencing the same memory
+     */
+    template<typename SiT, typename Byte>
+    auto fromBytes(std::span<Byte> bytes) noexcept -> std::span<detail::CopyConst<Byte, SiT>> {
+        static_assert(std::is_same_v<std::remove_const_t<Byte>, std::byte>, "fromBytes requires a span of bytes");
+        using RawT = detail::CopyConst<Byte, typename SiT::type>;
+        assert(reinterpret_cast<std::uintptr_t>(bytes.data()) % alignof(SiT) == 0 && "Bytes are not aligned");
+        assert(bytes.size() % sizeof(SiT) == 0 && "Number of bytes is not a multiple of the size of the type");
+        // NOLINTNEXTLINE(cppcoreguidelines-pro-type-reinterpret-cast) alignment is checked above
+        return asSi<SiT>(std::span<RawT>{reinterpret_cast<RawT *>(bytes.data()), bytes.size() / sizeof(SiT)});
+    }
+
+    /**
+     * Convert SI values to the same unit with another underlying type (e.g. widen float to double or narrow double
+     * to float). The conversion is a single loop over contiguous memory without any dependencies between the elements
+     * which the compiler vectorizes, conversions without native vector support are specialized (see SiHalf.hpp).
+     * @tparam SiFrom the (possibly const) SI type of the input
+     * @tparam SiTo the SI type of the output, needs to have the same unit as SiFrom
+     * @tparam ExtentFrom the extent of the input
+     * @tparam ExtentTo the extent of the output
+     * @param from the values to convert
+     * @param to the converted values, needs to have the same size as from
+     */
+    template<typename SiFrom, typename SiTo, std::size_t ExtentFrom, std::size_t ExtentTo>
+    void convertPrecision(std::span<SiFrom, ExtentFrom> from, std::span<SiTo, ExtentTo> to) noexcept {
+        using From = std::remove_const_t<SiFrom>;
+        static_assert(IsSi<From>::val && IsSi<SiTo>::val, "convertPrecision requires spans of SI values");
+        static_assert(std::is_same_v<typename detail::Rebind<From, typename SiTo::type>::type, SiTo>,
+                      "convertPrecision can not change the unit");
+        assert(from.size() == to.size() && "Input and output need to have the same size");
+        detail::BulkConversion<typename From::type, typename SiTo::type>::convert(asRaw(from).data(),
+                                                                                   asRaw(to).data(), from.size());
+    }
+} // namespace si
+
+#endif
@@ -0,0 +1,431 @@
+/**
+ * @file SiStats.hpp
+ * @author paul
+ * @date 17.10.26
+ * @brief Single pass statistics (mean, variance, minimum, maximum, RMS) of streams of SI values, results have the
+ * correct units. Requires C++20.
+ * @ingroup SI
+ */
+#ifndef SI_SISTATS_HPP
+#define SI_SISTATS_HPP
+
+#include <cassert>
+#include <cstddef>
+#include <limits>
+#include <span>
+#include <type_traits>
+#include <utility>
+
+#include "SiImpl.hpp"
+#include "SiSpan.hpp"
+#include "SiStl.hpp"
+#include "SiStlBatch.hpp"
+
+namespace si {
+    namespace detail {
+        /**
+         * Count, mean, sum of squared differences to the mean, minimum and maximum of a block of values.
+         * @tparam C the type used for the computations
+         */
+        template<typename C>
+        struct Moments {
+            std::size_t count; ///< Number of values
+            C mean;            ///< Mean of the values
+            C m2;              ///< Sum of the squared differences to the mean
+            C min;             ///< Smallest value
+            C max;             ///< Largest value
+        };
+
+        /**
+         * Minimum of the current minimum and a value, NaN values are ignored: a NaN value does not change the
+         * minimum, a NaN minimum (i.e. only NaN values so far) is replaced by the value.
+         * @tparam C the type used for the computations
+         * @param min the current minimum
+         * @param val the value
+         * @return the new minimum
+         */
+        template<typename C>
+        constexpr auto minIgnoringNaN(C min, C val) noexcept -> C {
+            return val < min || min != min ? val : min; // NOLINT(misc-redundant-expression) min != min checks NaN
+        }
+
+        /**
+         * Maximum of the current maximum and a value, NaN values are ignored like by minIgnoringNaN.
+         * @tparam C the type used for the computations
+         * @param max the current maximum
+         * @param val the value
+         * @return the new maximum
+         */
+        template<typename C>
+        constexpr auto maxIgnoringNaN(C max, C val) noexcept -> C {
+            return val > max || max != max ? val : max; // NOLINT(misc-redundant-expression) max != max checks NaN
+        }
+
+        /**
+         * Moments of a (non empty) block of values using two passes, the second pass reads the block from the cache.
+         * @tparam C the type used for the computations
+         * @tparam T the type of the values
+         * @param in the values
+         * @param size the number of values
+         * @return the moments of the block
+         */
+        template<typename C, typename T>
+        auto blockMoments(const T *in, std::size_t size) noexcept -> Moments<C> {
+            C sum{0};
+            auto min = static_cast<C>(in[0]);
+            auto max = min;
+            for (std::size_t i = 0; i < size; ++i) {
+                auto val = static_cast<C>(in[i]);
+                sum += val;
+                min = minIgnoringNaN(min, val);
+                max = maxIgnoringNaN(max, val);
+            }
+            auto mean = sum / static_cast<C>(size);
+            C m2{0};
+            for (std::size_t i = 0; i < size; ++i) {
+                auto diff = static_cast<C>(in[i]) - mean;
+                m2 += diff * diff;
+            }
+            return {size, mean, m2, min, max};
+        }
+
+        /**
+         * AVX2 kernels for the moments of a block.
+         * @tparam T the underlying type, only double and float are supported
+         */
+        template<typename T>
+        struct StatsAvx2 {
+            static constexpr bool available = false; ///< No kernels for this type
+        };
+
+#if SI_STL_BATCH_AVX2
+        /**
+         * AVX2 kernels for the moments of a block of doubles.
+         */
+        template<>
+        struct StatsAvx2<double> {
+            static constexpr bool available = true; ///< Kernels are available
+            static constexpr std::size_t lanes = 4; ///< Values per register
+
+            /**
+             * Sum of the lanes of a register.
+             * @param val the register
+             * @return the sum
+             */
+            SI_TARGET_AVX2 static auto horizontalSum(__m256d val) noexcept -> double {
+                auto sum = _mm_add_pd(_mm256_castpd256_pd128(val), _mm256_extractf128_pd(val, 1));
+                return _mm_cvtsd_f64(_mm_add_sd(sum, _mm_unpackhi_pd(sum, sum)));
+            }
+
+            /**
+             * Moments of a (non empty) block of values.
+             * @param in the values
+             * @param size the number of values
+             * @return the moments of the block
+             */
+            SI_TARGET_AVX2 static auto moments(const double *in, std::size_t size) noexcept -> Moments<double> {
+                auto sum = _mm256_setzero_pd();
+                // min_pd and max_pd return the second operand if one is NaN, so NaN values are ignored as long as the
+                // lanes start with a number
+                auto minVec = _mm256_set1_pd(std::numeric_limits<double>::infinity());
+                auto maxVec = _mm256_set1_pd(-std::numeric_limits<double>::infinity());
+                std::size_t i = 0;
+                for (; i + lanes <= size; i += lanes) {
+                    auto val = _mm256_loadu_pd(in + i);
+                    sum = _mm256_add_pd(sum, val);
+                    minVec = _mm256_min_pd(val, minVec);
+                    maxVec = _mm256_max_pd(val, maxVec);
+                }
+                alignas(32) double minLanes[lanes];
+                alignas(32) double maxLanes[lanes];
+                _mm256_store_pd(minLanes, minVec);
+                _mm256_store_pd(maxLanes, maxVec);
+                auto total = horizontalSum(sum);
+                auto min = minLanes[0];
+                auto max = maxLanes[0];
+                for (std::size_t lane = 1; lane < lanes; ++lane) {
+                    min = minIgnoringNaN(min, minLanes[lane]);
+                    max = maxIgnoringNaN(max, maxLanes[lane]);
+                }
+                for (std::size_t j = i; j < size; ++j) {
+                    total += in[j];
+                    min = minIgnoringNaN(min, in[j]);
+                    max = maxIgnoringNaN(max, in[j]);
+                }
+                if (min > max) { // Only NaN values
+                    min = max = std::numeric_limits<double>::quiet_NaN();
+                }
+
+                auto mean = total / static_cast<double>(size);
+                auto meanVec = _mm256_set1_pd(mean);
+                auto m2Vec = _mm256_setzero_pd();
+                for (i = 0; i + lanes <= size; i += lanes) {
+                    auto diff = _mm256_sub_pd(_mm256_loadu_pd(in + i), meanVec);
+                    m2Vec = _mm256_add_pd(m2Vec, _mm256_mul_pd(diff, diff));
+                }
+                auto m2 = horizontalSum(m2Vec);
+                for (; i < size; ++i) {
+                    m2 += (in[i] - mean) * (in[i] - mean);
+                }
+                return {size, mean, m2, min, max};
+            }
+        };
+
+        /**
+         * AVX2 kernels for the moments of a block of floats, the values are converted to double for the sums so the
+         * moments have the same precision as the ones of the scalar version.
+         */
+        template<>
+        struct StatsAvx2<float> {
+            static constexpr bool available = true; ///< Kernels are available
+            static constexpr std::size_t lanes = 8; ///< Values per register
+
+            /**
+             * Moments of a (non empty) block of values.
+             * @param in the values
+             * @param size the number of values
+             * @return the moments of the block
+             */
+            SI_TARGET_AVX2 static auto moments(const float *in, std::size_t size) noexcept -> Moments<double> {
+                auto sumLow = _mm256_setzero_pd();
+                auto sumHigh = _mm256_setzero_pd();
+                // See StatsAvx2<double>::moments for the handling of NaN
+                auto minVec = _mm256_set1_ps(std::numeric_limits<float>::infinity());
+                auto maxVec = _mm256_set1_ps(-std::numeric_limits<float>::infinity());
+                std::size_t i = 0;
+                for (; i + lanes <= size; i += lanes) {
+                    auto val = _mm256_loadu_ps(in + i);
+                    sumLow = _mm256_add_pd(sumLow, _mm256_cvtps_pd(_mm256_castps256_ps128(val)));
+                    sumHigh = _mm256_add_pd(sumHigh, _mm256_cvtps_pd(_mm256_extractf128_ps(val, 1)));
+                    minVec = _mm256_min_ps(val, minVec);
+                    maxVec = _mm256_max_ps(val, maxVec);
+                }
+                alignas(32) float minLanes[lanes];
+                alignas(32) float maxLanes[lanes];
+                _mm256_store_ps(minLanes, minVec);
+                _mm256_store_ps(maxLanes, maxVec);
+                auto total = StatsAvx2<double>::horizontalSum(_mm256_add_pd(sumLow, sumHigh));
+                auto min = minLanes[0];
+                auto max = maxLanes[0];
+                for (std::size_t lane = 1; lane < lanes; ++lane) {
+                    min = minIgnoringNaN(min, minLanes[lane]);
+                    max = maxIgnoringNaN(max, maxLanes[lane]);
+                }
+                for (std::size_t j = i; j < size; ++j) {
+                    total += static_cast<double>(in[j]);
+                    min = minIgnoringNaN(min, in[j]);
+                    max = maxIgnoringNaN(max, in[j]);
+                }
+                if (min > max) { // Only NaN values
+                    min = max = std::numeric_limits<float>::quiet_NaN();
+                }
+
+                auto mean = total / static_cast<double>(size);
+                auto meanVec = _mm256_set1_pd(mean);
+                auto m2Low = _mm256_setzero_pd();
+                auto m2High = _mm256_setzero_pd();
+                for (i = 0; i + lanes <= size; i += lanes) {
+                    auto val = _mm256_loadu_ps(in + i);
+                    auto diffLow = _mm256_sub_pd(_mm256_cvtps_pd(_mm256_castps256_ps128(val)), meanVec);
+                    auto diffHigh = _mm256_sub_pd(_mm256_cvtps_pd(_mm256_extractf128_ps(val, 1)), meanVec);
+                    m2Low = _mm256_add_pd(m2Low, _mm256_mul_pd(diffLow, diffLow));
+                    m2High = _mm256_add_pd(m2High, _mm256_mul_pd(diffHigh, diffHigh));
+                }
+                auto m2 = StatsAvx2<double>::horizontalSum(_mm256_add_pd(m2Low, m2High));
+                for (; i < size; ++i) {
+                    auto diff = static_cast<double>(in[i]) - mean;
+                    m2 += diff * diff;
+                }
+                return {size, mean, m2, min, max};
+            }
+        };
+#endif
+    } // namespace detail
+
+    /**
+     * Accumulator for the statistics of a stream of SI values. Single values are added using Welford's algorithm,
+     * spans are processed in blocks (vectorized using AVX2 if available) which are combined using the algorithm of
+     * Chan et al. Accumulators of different parts of a stream (e.g. one per thread) can be merged, the result does
+     * not depend on how the stream was split (up to rounding).
+     * @tparam Unit the SI type of the values
+     */
+    template<typename Unit>
+    class Stats {
+        static_assert(IsSi<Unit>::val, "Stats requires an SI type");
+
+      public:
+        using type = typename Unit::type; ///< Underlying type of the values
+        /**
+         * Type of the accumulated moments, at least double so long streams of float values do not lose precision.
+         */
+        using accumulate_type = std::common_type_t<typename ComputeType<type>::type, double>;
+        using square_type = decltype(std::declval<Unit>() * std::declval<Unit>()); ///< Unit of the variance
+        static constexpr std::size_t blockSize = 2048; ///< Values per block when adding a span
+
+        /**
+         * Add a value.
+         * @param val the value
+         */
+        constexpr void add(Unit val) noexcept {
+            auto x = static_cast<accumulate_type>(static_cast<type>(val));
+            ++count_;
+            if (count_ == 1) {
+                min_ = x;
+                max_ = x;
+            } else {
+                min_ = detail::minIgnoringNaN(min_, x);
+                max_ = detail::maxIgnoringNaN(max_, x);
+            }
+            auto delta = x - mean_;
+            mean_ += delta / static_cast<accumulate_type>(count_);
+            m2_ += delta * (x - mean_);
+        }
+
+        /**
+         * Add many values.
+         * @param vals the values
+         */
+        void add(std::span<const Unit> vals) noexcept {
+            auto raw = asRaw(vals);
+            for (std::size_t begin = 0; begin < raw.size(); begin += blockSize) {
+                auto size = raw.size() - begin < blockSize ? raw.size() - begin : blockSize;
+                merge(blockMoments(raw.data() + begin, size));
+            }
+        }
+
+        /**
+         * Merge the statistics of another accumulator, afterwards this accumulator contains the statistics of the
+         * values of both accumulators.
+         * @param other the other accumulator
+         * @return this accumulator
+         */
+        constexpr auto merge(const Stats &other) noexcept -> Stats & {
+            merge(detail::Moments<accumulate_type>{other.count_, other.mean_, other.m2_, other.min_, other.max_});
+            return *this;
+        }
+
+        /**
+         * Number of values.
+         * @return the number of added values
+         */
+        [[nodiscard]] constexpr auto count() const noexcept -> std::size_t {
+            return count_;
+        }
+
+        /**
+         * Arithmetic mean, requires at least one value.
+         * @return the mean of all values
+         */
+        [[nodiscard]] constexpr auto mean() const noexcept -> Unit {
+            assert(count_ > 0 && "No values");
+            return Unit{static_cast<type>(mean_)};
+        }
+
+        /**
+         * Population variance (divided by the number of values), requires at least one value.
+         * @return the variance with the unit Unit * Unit
+         */
+        [[nodiscard]] constexpr auto variance() const noexcept -> square_type {
+            assert(count_ > 0 && "No values");
+            return square_type{static_cast<type>(m2_ / static_cast<accumulate_type>(count_))};
+        }
+
+        /**
+         * Sample variance (divided by the number of values minus one), requires at least two values.
+         * @return the unbiased estimate of the variance with the unit Unit * Unit
+         */
+        [[nodiscard]] constexpr auto sampleVariance() const noexcept -> square_type {
+            assert(count_ > 1 && "At least two values are required");
+            return square_type{static_cast<type>(m2_ / static_cast<accumulate_type>(count_ - 1))};
+        }
+
+        /**
+         * Population standard deviation, requires at least one value.
+         * @return the square root of the variance
+         */
+        [[nodiscard]] auto stddev() const noexcept -> Unit {
+            return std::sqrt(variance());
+        }
+
+        /**
+         * Sample standard deviation, requires at least two values.
+         * @return the square root of the sample variance
+         */
+        [[nodiscard]] auto sampleStddev() const noexcept -> Unit {
+            return std::sqrt(sampleVariance());
+        }
+
+        /**
+         * Root mean square, requires at least one value.
+         * @return the square root of the mean of the squared values
+         */
+        [[nodiscard]] auto rms() const noexcept -> Unit {
+            assert(count_ > 0 && "No values");
+            auto meanSquare = m2_ / static_cast<accumulate_type>(count_) + mean_ * mean_;
+            return std::sqrt(square_type{static_cast<type>(meanSquare)});
+        }
+
+        /**
+         * Smallest value, requires at least one value. NaN values are ignored, the result is only NaN if all values are
+         * NaN.
+         * @return the minimum
+         */
+        [[nodiscard]] constexpr auto min() const noexcept -> Unit {
+            assert(count_ > 0 && "No values");
+            return Unit{static_cast<type>(min_)};
+        }
+
+        /**
+         * Largest value, requires at least one value. NaN values are ignored, the result is only NaN if all values are
+         * NaN.
+         * @return the maximum
+         */
+        [[nodiscard]] constexpr auto max() const noexcept -> Unit {
+            assert(count_ > 0 && "No values");
+            return Unit{static_cast<type>(max_)};
+        }
+
+      private:
+        static auto blockMoments(const type *in, std::size_t size) noexcept -> detail::Moments<accumulate_type> {
+#if SI_STL_BATCH_AVX2
+            if constexpr (detail::StatsAvx2<type>::available) {
+                if (detail::hasAvx2()) {
+                    return detail::StatsAvx2<type>::moments(in, size);
+                }
+            }
+#endif
+            return detail::blockMoments<accumulate_type>(in, size);
+        }
+
+        constexpr void merge(const detail::Moments<accumulate_type> &other) noexcept {
+            if (other.count == 0) {
+                return;
+            }
+            if (count_ == 0) {
+                count_ = other.count;
+                mean_ = other.mean;
+                m2_ = other.m2;
+                min_ = other.min;
+                max_ = other.max;
+                return;
+            }
+            auto countA = static_cast<accumulate_type>(count_);
+            auto countB = static_cast<accumulate_type>(other.count);
+            auto total = countA + countB;
+            auto delta = other.mean - mean_;
+            mean_ += delta * (countB / total);
+            m2_ += other.m2 + delta * delta * (countA * countB / total);
+            min_ = detail::minIgnoringNaN(min_, other.min);
+            max_ = detail::maxIgnoringNaN(max_, other.max);
+            count_ += other.count;
+        }
+
+        std::size_t count_{0};
+        accumulate_type mean_{0};
+        accumulate_type m2_{0};
+        accumulate_type min_{0};
+        accumulate_type max_{0};
+    };
+} // namespace si
+
+#endif
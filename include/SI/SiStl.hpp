@@ -2,13 +2,15 @@
  * @file SiStl.hpp
  * @author paul
  * @date 03.04.20
- * @brief Specialization of STL functions for SI types.
+ * @brief Specialization of STL functions for SI types and integer powers, the functions are evaluated using
+ * si::ComputeType.
  * @ingroup SI
  */
 #ifndef SI_SISTL_HPP
 #define SI_SISTL_HPP
 
 #include <cmath>
+#include <type_traits>
 
 #include "SiImpl.hpp"
 
@@ -28,10 +30,12 @@ namespace std {
      */
     template<int m, int kg, int s, int A, int K, int MOL, int CD, typename T>
     auto sqrt(si::Si<m, kg, s, A, K, MOL, CD, T> si) -> si::Si<m / 2, kg / 2, s / 2, A / 2, K / 2, MOL / 2, CD / 2, T> {
+        using C = typename si::ComputeType<T>::type;
         static_assert(m % 2 == 0 && kg % 2 == 0 && s % 2 == 0 && A % 2 == 0 && K % 2 == 0 && MOL % 2 == 0 &&
                               CD % 2 == 0,
                       "sqrt not possible as resulting type has unit with non integer power of unit");
-        return si::Si<m / 2, kg / 2, s / 2, A / 2, K / 2, MOL / 2, CD / 2, T>{std::sqrt(static_cast<T>(si))};
+        return si::Si<m / 2, kg / 2, s / 2, A / 2, K / 2, MOL / 2, CD / 2, T>{
+                static_cast<T>(std::sqrt(static_cast<C>(si)))};
     }
 
     /**
@@ -49,7 +53,8 @@ namespace std {
      */
     template<int m, int kg, int s, int A, int K, int MOL, int CD, typename T>
     auto abs(si::Si<m, kg, s, A, K, MOL, CD, T> si) -> si::Si<m, kg, s, A, K, MOL, CD, T> {
-        return si::Si<m, kg, s, A, K, MOL, CD, T>{std::abs(static_cast<T>(si))};
+        using C = typename si::ComputeType<T>::type;
+        return si::Si<m, kg, s, A, K, MOL, CD, T>{static_cast<T>(std::abs(static_cast<C>(si)))};
     }
 
     /**
@@ -67,7 +72,8 @@ namespace std {
      */
     template<int m, int kg, int s, int A, int K, int MOL, int CD, typename T>
     auto round(si::Si<m, kg, s, A, K, MOL, CD, T> si) -> si::Si<m, kg, s, A, K, MOL, CD, T> {
-        return si::Si<m, kg, s, A, K, MOL, CD, T>{std::round(static_cast<T>(si))};
+        using C = typename si::ComputeType<T>::type;
+        return si::Si<m, kg, s, A, K, MOL, CD, T>{static_cast<T>(std::round(static_cast<C>(si)))};
     }
 
     /**
@@ -85,7 +91,8 @@ namespace std {
      */
     template<int m, int kg, int s, int A, int K, int MOL, int CD, typename T>
     auto isnan(si::Si<m, kg, s, A, K, MOL, CD, T> si) -> bool {
-        return std::isnan(static_cast<T>(si));
+        using C = typename si::ComputeType<T>::type;
+        return std::isnan(static_cast<C>(si));
     }
 
     /**
@@ -104,8 +111,235 @@ namespace std {
      */
     template<int m, int kg, int s, int A, int K, int MOL, int CD, typename T>
     auto atan2(si::Si<m, kg, s, A, K, MOL, CD, T> y, si::Si<m, kg, s, A, K, MOL, CD, T> x) -> T {
-        return std::atan2(static_cast<T>(y), static_cast<T>(x));
+        using C = typename si::ComputeType<T>::type;
+        return static_cast<T>(std::atan2(static_cast<C>(y), static_cast<C>(x)));
+    }
+
+    /**
+     * Implementation of the cube root function for SI types, required that all exponents are multiple of 3.
+     * @tparam m the meter exponent
+     * @tparam kg the kilogram exponent
+     * @tparam s the second exponent
+     * @tparam A the Ampere exponent
+     * @tparam K the Kelvin exponent
+     * @tparam MOL the Mol exponent
+     * @tparam CD the Candela exponent
+     * @tparam T the underlying numerical type
+     * @param si the si variable
+     * @return an SI object with unit as cbrt(unit) and value as cbrt(value)
+     */
+    template<int m, int kg, int s, int A, int K, int MOL, int CD, typename T>
+    auto cbrt(si::Si<m, kg, s, A, K, MOL, CD, T> si) -> si::Si<m / 3, kg / 3, s / 3, A / 3, K / 3, MOL / 3, CD / 3, T> {
+        using C = typename si::ComputeType<T>::type;
+        static_assert(m % 3 == 0 && kg % 3 == 0 && s % 3 == 0 && A % 3 == 0 && K % 3 == 0 && MOL % 3 == 0 &&
+                              CD % 3 == 0,
+                      "cbrt not possible as resulting type has unit with non integer power of unit");
+        return si::Si<m / 3, kg / 3, s / 3, A / 3, K / 3, MOL / 3, CD / 3, T>{
+                static_cast<T>(std::cbrt(static_cast<C>(si)))};
+    }
+
+    /**
+     * Implementation of the floor function for SI types.
+     * @tparam m the meter exponent
+     * @tparam kg the kilogram exponent
+     * @tparam s the second exponent
+     * @tparam A the Ampere exponent
+     * @tparam K the Kelvin exponent
+     * @tparam MOL the Mol exponent
+     * @tparam CD the Candela exponent
+     * @tparam T the underlying numerical type
+     * @param si the si variable
+     * @return an SI object with unit as the original unit and value as floor(value)
+     */
+    template<int m, int kg, int s, int A, int K, int MOL, int CD, typename T>
+    auto floor(si::Si<m, kg, s, A, K, MOL, CD, T> si) -> si::Si<m, kg, s, A, K, MOL, CD, T> {
+        using C = typename si::ComputeType<T>::type;
+        return si::Si<m, kg, s, A, K, MOL, CD, T>{static_cast<T>(std::floor(static_cast<C>(si)))};
+    }
+
+    /**
+     * Implementation of the ceil function for SI types.
+     * @tparam m the meter exponent
+     * @tparam kg the kilogram exponent
+     * @tparam s the second exponent
+     * @tparam A the Ampere exponent
+     * @tparam K the Kelvin exponent
+     * @tparam MOL the Mol exponent
+     * @tparam CD the Candela exponent
+     * @tparam T the underlying numerical type
+     * @param si the si variable
+     * @return an SI object with unit as the original unit and value as ceil(value)
+     */
+    template<int m, int kg, int s, int A, int K, int MOL, int CD, typename T>
+    auto ceil(si::Si<m, kg, s, A, K, MOL, CD, T> si) -> si::Si<m, kg, s, A, K, MOL, CD, T> {
+        using C = typename si::ComputeType<T>::type;
+        return si::Si<m, kg, s, A, K, MOL, CD, T>{static_cast<T>(std::ceil(static_cast<C>(si)))};
+    }
+
+    /**
+     * Implementation of the hypot function for two variables of identical unit, sqrt(x^2 + y^2) without
+     * intermediate overflow or underflow.
+     * @tparam m the meter exponent
+     * @tparam kg the kilogram exponent
+     * @tparam s the second exponent
+     * @tparam A the Ampere exponent
+     * @tparam K the Kelvin exponent
+     * @tparam MOL the Mol exponent
+     * @tparam CD the Candela exponent
+     * @tparam T the underlying numerical type
+     * @param x the first variable
+     * @param y the second variable
+     * @return an SI object with the unit of the arguments
+     */
+    template<int m, int kg, int s, int A, int K, int MOL, int CD, typename T>
+    auto hypot(si::Si<m, kg, s, A, K, MOL, CD, T> x, si::Si<m, kg, s, A, K, MOL, CD, T> y)
+            -> si::Si<m, kg, s, A, K, MOL, CD, T> {
+        using C = typename si::ComputeType<T>::type;
+        return si::Si<m, kg, s, A, K, MOL, CD, T>{static_cast<T>(std::hypot(static_cast<C>(x), static_cast<C>(y)))};
+    }
+
+    /**
+     * Implementation of the hypot function for three variables of identical unit, sqrt(x^2 + y^2 + z^2) without
+     * intermediate overflow or underflow.
+     * @tparam m the meter exponent
+     * @tparam kg the kilogram exponent
+     * @tparam s the second exponent
+     * @tparam A the Ampere exponent
+     * @tparam K the Kelvin exponent
+     * @tparam MOL the Mol exponent
+     * @tparam CD the Candela exponent
+     * @tparam T the underlying numerical type
+     * @param x the first variable
+     * @param y the second variable
+     * @param z the third variable
+     * @return an SI object with the unit of the arguments
+     */
+    template<int m, int kg, int s, int A, int K, int MOL, int CD, typename T>
+    auto hypot(si::Si<m, kg, s, A, K, MOL, CD, T> x, si::Si<m, kg, s, A, K, MOL, CD, T> y,
+               si::Si<m, kg, s, A, K, MOL, CD, T> z) -> si::Si<m, kg, s, A, K, MOL, CD, T> {
+        using C = typename si::ComputeType<T>::type;
+        return si::Si<m, kg, s, A, K, MOL, CD, T>{
+                static_cast<T>(std::hypot(static_cast<C>(x), static_cast<C>(y), static_cast<C>(z)))};
+    }
+
+    /**
+     * Implementation of the fused multiply-add function for SI types, calculates a * b + c with a single rounding.
+     * The unit of c needs to be the unit of a * b.
+     * @tparam m1 the meter exponent of a
+     * @tparam kg1 the kilogram exponent of a
+     * @tparam s1 the second exponent of a
+     * @tparam A1 the Ampere exponent of a
+     * @tparam K1 the Kelvin exponent of a
+     * @tparam MOL1 the Mol exponent of a
+     * @tparam CD1 the Candela exponent of a
+     * @tparam m2 the meter exponent of b
+     * @tparam kg2 the kilogram exponent of b
+     * @tparam s2 the second exponent of b
+     * @tparam A2 the Ampere exponent of b
+     * @tparam K2 the Kelvin exponent of b
+     * @tparam MOL2 the Mol exponent of b
+     * @tparam CD2 the Candela exponent of b
+     * @tparam SiC the type of c
+     * @tparam T the underlying numerical type
+     * @param a the first factor
+     * @param b the second factor
+     * @param c the summand
+     * @return an SI object with unit of a * b and value a * b + c
+     */
+    template<int m1, int kg1, int s1, int A1, int K1, int MOL1, int CD1, int m2, int kg2, int s2, int A2, int K2,
+             int MOL2, int CD2, typename SiC, typename T>
+    auto fma(si::Si<m1, kg1, s1, A1, K1, MOL1, CD1, T> a, si::Si<m2, kg2, s2, A2, K2, MOL2, CD2, T> b, SiC c)
+            -> si::Si<m1 + m2, kg1 + kg2, s1 + s2, A1 + A2, K1 + K2, MOL1 + MOL2, CD1 + CD2, T> {
+        using Res = si::Si<m1 + m2, kg1 + kg2, s1 + s2, A1 + A2, K1 + K2, MOL1 + MOL2, CD1 + CD2, T>;
+        using C = typename si::ComputeType<T>::type;
+        static_assert(std::is_same_v<SiC, Res>, "fma requires the summand to have the unit of the product");
+        return Res{static_cast<T>(std::fma(static_cast<C>(a), static_cast<C>(b), static_cast<C>(c)))};
+    }
+
+    /**
+     * Implementation of the fused multiply-add function for a SI type scaled by a scalar, calculates a * b + c with
+     * a single rounding.
+     * @tparam m the meter exponent
+     * @tparam kg the kilogram exponent
+     * @tparam s the second exponent
+     * @tparam A the Ampere exponent
+     * @tparam K the Kelvin exponent
+     * @tparam MOL the Mol exponent
+     * @tparam CD the Candela exponent
+     * @tparam T the underlying numerical type
+     * @param a the factor with unit
+     * @param b the unitless factor
+     * @param c the summand
+     * @return an SI object with unit of a and value a * b + c
+     */
+    template<int m, int kg, int s, int A, int K, int MOL, int CD, typename T>
+    auto fma(si::Si<m, kg, s, A, K, MOL, CD, T> a, typename si::Si<m, kg, s, A, K, MOL, CD, T>::type b,
+             si::Si<m, kg, s, A, K, MOL, CD, T> c) -> si::Si<m, kg, s, A, K, MOL, CD, T> {
+        using C = typename si::ComputeType<T>::type;
+        return si::Si<m, kg, s, A, K, MOL, CD, T>{
+                static_cast<T>(std::fma(static_cast<C>(a), static_cast<C>(b), static_cast<C>(c)))};
+    }
+
+    /**
+     * Implementation of the fused multiply-add function for a scalar scaling a SI type, calculates a * b + c with
+     * a single rounding.
+     * @tparam m the meter exponent
+     * @tparam kg the kilogram exponent
+     * @tparam s the second exponent
+     * @tparam A the Ampere exponent
+     * @tparam K the Kelvin exponent
+     * @tparam MOL the Mol exponent
+     * @tparam CD the Candela exponent
+     * @tparam T the underlying numerical type
+     * @param a the unitless factor
+     * @param b the factor with unit
+     * @param c the summand
+     * @return an SI object with unit of b and value a * b + c
+     */
+    template<int m, int kg, int s, int A, int K, int MOL, int CD, typename T>
+    auto fma(typename si::Si<m, kg, s, A, K, MOL, CD, T>::type a, si::Si<m, kg, s, A, K, MOL, CD, T> b,
+             si::Si<m, kg, s, A, K, MOL, CD, T> c) -> si::Si<m, kg, s, A, K, MOL, CD, T> {
+        return std::fma(b, a, c);
     }
 } // namespace std
 
+namespace si {
+    /**
+     * Integer power of an SI type, all exponents of the unit are multiplied by N. The power is calculated by
+     * repeated squaring so the function can be evaluated at compile time.
+     * @tparam N the exponent, may be negative or zero
+     * @tparam m the meter exponent
+     * @tparam kg the kilogram exponent
+     * @tparam s the second exponent
+     * @tparam A the Ampere exponent
+     * @tparam K the Kelvin exponent
+     * @tparam MOL the Mol exponent
+     * @tparam CD the Candela exponent
+     * @tparam T the underlying numerical type
+     * @param base the base
+     * @return an SI object with unit as unit^N and value as value^N
+     */
+    template<int N, int m, int kg, int s, int A, int K, int MOL, int CD, typename T>
+    constexpr auto pow(Si<m, kg, s, A, K, MOL, CD, T> base)
+            -> Si<m * N, kg * N, s * N, A * N, K * N, MOL * N, CD * N, T> {
+        using C = typename ComputeType<T>::type;
+        using Res = Si<m * N, kg * N, s * N, A * N, K * N, MOL * N, CD * N, T>;
+        if constexpr (N < 0) {
+            return Res{static_cast<T>(C{1} / static_cast<C>(pow<-N>(base)))};
+        } else {
+            C res{1};
+            auto val = static_cast<C>(base);
+            for (int n = N; n > 0; n /= 2) {
+                if (n % 2 == 1) {
+                    res *= val;
+                }
+                if (n > 1) {
+                    val *= val;
+                }
+            }
+            return Res{static_cast<T>(res)};
+        }
+    }
+} // namespace si
+
 #endif
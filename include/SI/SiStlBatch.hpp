@@ -0,0 +1,510 @@
+/**
+ * @file SiStlBatch.hpp
+ * @author paul
+ * @date 17.10.26
+ * @brief Versions of the functions of SiStl.hpp for spans of SI values, AVX2 kernels are selected at runtime if the
+ * CPU supports them. Requires C++20.
+ * @ingroup SI
+ */
+#ifndef SI_SISTLBATCH_HPP
+#define SI_SISTLBATCH_HPP
+
+#include <cassert>
+#include <cmath>
+#include <cstddef>
+#include <span>
+#include <type_traits>
+
+#include "SiImpl.hpp"
+#include "SiSpan.hpp"
+#include "SiStl.hpp"
+
+#if !defined(SI_STL_BATCH_NO_AVX2) && (defined(__GNUC__) || defined(__clang__)) &&                                 \
+        (defined(__x86_64__) || defined(__i386__))
+    #include <immintrin.h>
+    #define SI_STL_BATCH_AVX2 1 ///< AVX2 kernels are available and selected at runtime
+    // NOLINTNEXTLINE(cppcoreguidelines-macro-usage) attribute can not be replaced by constexpr function
+    #define SI_TARGET_AVX2 __attribute__((target("avx2"))) ///< Compile a function for AVX2
+#else
+    #define SI_STL_BATCH_AVX2 0 ///< Only the generic loops are available
+#endif
+
+namespace si {
+    namespace detail {
+#if SI_STL_BATCH_AVX2
+        /**
+         * Check whether the CPU supports AVX2, the result is cached. If the code is compiled with AVX2 enabled this
+         * is a compile time constant.
+         * @return true if the AVX2 kernels can be used
+         */
+        inline auto hasAvx2() noexcept -> bool {
+    #ifdef __AVX2__
+            return true;
+    #else
+            static const bool supported = [] {
+                __builtin_cpu_init();
+                return __builtin_cpu_supports("avx2") != 0;
+            }();
+            return supported;
+    #endif
+        }
+
+        /**
+         * Arctangent of non special values (i.e. finite and non zero) of four lanes, the argument is reduced to
+         * [0, 0.66] and the arctangent approximated by a rational function (see the Cephes library).
+         * @param x the argument
+         * @return the arctangent
+         */
+        SI_TARGET_AVX2 inline auto atanPd(__m256d x) noexcept -> __m256d {
+            const auto signMask = _mm256_set1_pd(-0.0);
+            const auto one = _mm256_set1_pd(1.0);
+            const auto moreBits = _mm256_set1_pd(6.123233995736765886130E-17); // pi/2 - double(pi/2)
+
+            auto sign = _mm256_and_pd(x, signMask);
+            auto abs = _mm256_andnot_pd(signMask, x);
+            auto big = _mm256_cmp_pd(abs, _mm256_set1_pd(2.41421356237309504880), _CMP_GT_OQ); // tan(3pi/8)
+            auto mid = _mm256_andnot_pd(big, _mm256_cmp_pd(abs, _mm256_set1_pd(0.66), _CMP_GT_OQ));
+
+            auto shifted = _mm256_div_pd(_mm256_sub_pd(abs, one), _mm256_add_pd(abs, one));
+            auto reduced = _mm256_blendv_pd(abs, shifted, mid);
+            reduced = _mm256_blendv_pd(reduced, _mm256_div_pd(_mm256_set1_pd(-1.0), abs), big);
+            auto offset = _mm256_blendv_pd(_mm256_setzero_pd(), _mm256_set1_pd(0.78539816339744830962), mid);
+            offset = _mm256_blendv_pd(offset, _mm256_set1_pd(1.57079632679489661923), big);
+            auto correction = _mm256_blendv_pd(_mm256_setzero_pd(), _mm256_mul_pd(moreBits, _mm256_set1_pd(0.5)),
+                                               mid);
+            correction = _mm256_blendv_pd(correction, moreBits, big);
+
+            auto z = _mm256_mul_pd(reduced, reduced);
+            auto p = _mm256_set1_pd(-8.750608600031904122785E-1);
+            p = _mm256_add_pd(_mm256_mul_pd(p, z), _mm256_set1_pd(-1.615753718733365076637E1));
+            p = _mm256_add_pd(_mm256_mul_pd(p, z), _mm256_set1_pd(-7.500855792314704667340E1));
+            p = _mm256_add_pd(_mm256_mul_pd(p, z), _mm256_set1_pd(-1.228866684490136173410E2));
+            p = _mm256_add_pd(_mm256_mul_pd(p, z), _mm256_set1_pd(-6.485021904942025371773E1));
+            auto q = _mm256_add_pd(z, _mm256_set1_pd(2.485846490142306297962E1));
+            q = _mm256_add_pd(_mm256_mul_pd(q, z), _mm256_set1_pd(1.650270098316988542046E2));
+            q = _mm256_add_pd(_mm256_mul_pd(q, z), _mm256_set1_pd(4.328810604912902668951E2));
+            q = _mm256_add_pd(_mm256_mul_pd(q, z), _mm256_set1_pd(4.853903996359136964868E2));
+            q = _mm256_add_pd(_mm256_mul_pd(q, z), _mm256_set1_pd(1.945506571482613964425E2));
+
+            auto res = _mm256_add_pd(_mm256_mul_pd(reduced, _mm256_div_pd(_mm256_mul_pd(z, p), q)), reduced);
+            res = _mm256_add_pd(offset, _mm256_add_pd(res, correction));
+            return _mm256_xor_pd(res, sign);
+        }
+
+        /**
+         * Four quadrant arctangent of four lanes, lanes with special values (zero, infinity or NaN) are marked in
+         * a mask and need to be calculated by std::atan2.
+         * @param y the y coordinates
+         * @param x the x coordinates
+         * @param special set to the mask of lanes with special values
+         * @return the angles
+         */
+        SI_TARGET_AVX2 inline auto atan2Pd(__m256d y, __m256d x, int &special) noexcept -> __m256d {
+            const auto signMask = _mm256_set1_pd(-0.0);
+            const auto inf = _mm256_set1_pd(HUGE_VAL);
+            const auto zero = _mm256_setzero_pd();
+            auto mask = _mm256_or_pd(_mm256_cmp_pd(x, zero, _CMP_EQ_OQ), _mm256_cmp_pd(y, zero, _CMP_EQ_OQ));
+            mask = _mm256_or_pd(mask, _mm256_cmp_pd(_mm256_andnot_pd(signMask, x), inf, _CMP_EQ_OQ));
+            mask = _mm256_or_pd(mask, _mm256_cmp_pd(_mm256_andnot_pd(signMask, y), inf, _CMP_EQ_OQ));
+            mask = _mm256_or_pd(mask, _mm256_cmp_pd(x, y, _CMP_UNORD_Q));
+            special = _mm256_movemask_pd(mask);
+
+            // Add pi with the sign of y if x is negative
+            auto pi = _mm256_or_pd(_mm256_set1_pd(3.14159265358979323846), _mm256_and_pd(y, signMask));
+            auto offset = _mm256_and_pd(_mm256_cmp_pd(x, zero, _CMP_LT_OQ), pi);
+            return _mm256_add_pd(offset, atanPd(_mm256_div_pd(y, x)));
+        }
+
+        /**
+         * AVX2 kernels on the underlying values, the number of values does not need to be a multiple of the
+         * number of lanes.
+         * @tparam T the underlying type, only double and float are supported
+         */
+        template<typename T>
+        struct Avx2Kernels {
+            static constexpr bool available = false; ///< No kernels for this type
+        };
+
+        /**
+         * AVX2 kernels for double.
+         */
+        template<>
+        struct Avx2Kernels<double> {
+            static constexpr bool available = true; ///< Kernels are available
+            static constexpr std::size_t lanes = 4; ///< Values per register
+
+            /**
+             * Square root of all values.
+             * @param in the input values
+             * @param out the output values
+             * @param size the number of values
+             */
+            SI_TARGET_AVX2 static void sqrt(const double *in, double *out, std::size_t size) noexcept {
+                std::size_t i = 0;
+                for (; i + lanes <= size; i += lanes) {
+                    _mm256_storeu_pd(out + i, _mm256_sqrt_pd(_mm256_loadu_pd(in + i)));
+                }
+                for (; i < size; ++i) {
+                    out[i] = std::sqrt(in[i]);
+                }
+            }
+
+            /**
+             * Absolute value of all values.
+             * @param in the input values
+             * @param out the output values
+             * @param size the number of values
+             */
+            SI_TARGET_AVX2 static void abs(const double *in, double *out, std::size_t size) noexcept {
+                const auto signMask = _mm256_set1_pd(-0.0);
+                std::size_t i = 0;
+                for (; i + lanes <= size; i += lanes) {
+                    _mm256_storeu_pd(out + i, _mm256_andnot_pd(signMask, _mm256_loadu_pd(in + i)));
+                }
+                for (; i < size; ++i) {
+                    out[i] = std::abs(in[i]);
+                }
+            }
+
+            /**
+             * Round all values to the nearest integer, halfway cases are rounded away from zero and the sign is kept
+             * (like std::round, e.g. -0.3 is rounded to -0.0).
+             * @param in the input values
+             * @param out the output values
+             * @param size the number of values
+             */
+            SI_TARGET_AVX2 static void round(const double *in, double *out, std::size_t size) noexcept {
+                const auto signMask = _mm256_set1_pd(-0.0);
+                const auto half = _mm256_set1_pd(0.5);
+                const auto one = _mm256_set1_pd(1.0);
+                std::size_t i = 0;
+                for (; i + lanes <= size; i += lanes) {
+                    auto val = _mm256_loadu_pd(in + i);
+                    auto trunc = _mm256_round_pd(val, _MM_FROUND_TO_ZERO | _MM_FROUND_NO_EXC);
+                    auto frac = _mm256_andnot_pd(signMask, _mm256_sub_pd(val, trunc)); // Exact
+                    auto step = _mm256_or_pd(one, _mm256_and_pd(val, signMask));
+                    auto roundUp = _mm256_cmp_pd(frac, half, _CMP_GE_OQ);
+                    auto res = _mm256_add_pd(trunc, _mm256_and_pd(roundUp, step));
+                    // trunc + 0 is +0 for values in (-0.5, 0), the sign of the input is restored
+                    _mm256_storeu_pd(out + i, _mm256_or_pd(res, _mm256_and_pd(val, signMask)));
+                }
+                for (; i < size; ++i) {
+                    out[i] = std::round(in[i]);
+                }
+            }
+
+            /**
+             * Check all values for NaN.
+             * @param in the input values
+             * @param out true for all NaN values
+             * @param size the number of values
+             */
+            SI_TARGET_AVX2 static void isnan(const double *in, bool *out, std::size_t size) noexcept {
+                std::size_t i = 0;
+                for (; i + lanes <= size; i += lanes) {
+                    auto val = _mm256_loadu_pd(in + i);
+                    auto mask = static_cast<unsigned>(_mm256_movemask_pd(_mm256_cmp_pd(val, val, _CMP_UNORD_Q)));
+                    for (std::size_t lane = 0; lane < lanes; ++lane) {
+                        out[i + lane] = ((mask >> lane) & 1U) != 0;
+                    }
+                }
+                for (; i < size; ++i) {
+                    out[i] = std::isnan(in[i]);
+                }
+            }
+
+            /**
+             * Four quadrant arctangent of all pairs of values, the error is at most 2 ulp (not bit identical to
+             * std::atan2).
+             * @param y the y coordinates
+             * @param x the x coordinates
+             * @param out the angles
+             * @param size the number of values
+             */
+            SI_TARGET_AVX2 static void atan2(const double *y, const double *x, double *out, std::size_t size) noexcept {
+                std::size_t i = 0;
+                for (; i + lanes <= size; i += lanes) {
+                    int special = 0;
+                    _mm256_storeu_pd(out + i, atan2Pd(_mm256_loadu_pd(y + i), _mm256_loadu_pd(x + i), special));
+                    if (special != 0) {
+                        for (std::size_t lane = 0; lane < lanes; ++lane) {
+                            out[i + lane] = std::atan2(y[i + lane], x[i + lane]);
+                        }
+                    }
+                }
+                for (; i < size; ++i) {
+                    out[i] = std::atan2(y[i], x[i]);
+                }
+            }
+        };
+
+        /**
+         * AVX2 kernels for float.
+         */
+        template<>
+        struct Avx2Kernels<float> {
+            static constexpr bool available = true; ///< Kernels are available
+            static constexpr std::size_t lanes = 8; ///< Values per register
+
+            /**
+             * Square root of all values.
+             * @param in the input values
+             * @param out the output values
+             * @param size the number of values
+             */
+            SI_TARGET_AVX2 static void sqrt(const float *in, float *out, std::size_t size) noexcept {
+                std::size_t i = 0;
+                for (; i + lanes <= size; i += lanes) {
+                    _mm256_storeu_ps(out + i, _mm256_sqrt_ps(_mm256_loadu_ps(in + i)));
+                }
+                for (; i < size; ++i) {
+                    out[i] = std::sqrt(in[i]);
+                }
+            }
+
+            /**
+             * Absolute value of all values.
+             * @param in the input values
+             * @param out the output values
+             * @param size the number of values
+             */
+            SI_TARGET_AVX2 static void abs(const float *in, float *out, std::size_t size) noexcept {
+                const auto signMask = _mm256_set1_ps(-0.0F);
+                std::size_t i = 0;
+                for (; i + lanes <= size; i += lanes) {
+                    _mm256_storeu_ps(out + i, _mm256_andnot_ps(signMask, _mm256_loadu_ps(in + i)));
+                }
+                for (; i < size; ++i) {
+                    out[i] = std::abs(in[i]);
+                }
+            }
+
+            /**
+             * Round all values to the nearest integer, halfway cases are rounded away from zero and the sign is kept
+             * (like std::round, e.g. -0.3 is rounded to -0.0).
+             * @param in the input values
+             * @param out the output values
+             * @param size the number of values
+             */
+            SI_TARGET_AVX2 static void round(const float *in, float *out, std::size_t size) noexcept {
+                const auto signMask = _mm256_set1_ps(-0.0F);
+                const auto half = _mm256_set1_ps(0.5F);
+                const auto one = _mm256_set1_ps(1.0F);
+                std::size_t i = 0;
+                for (; i + lanes <= size; i += lanes) {
+                    auto val = _mm256_loadu_ps(in + i);
+                    auto trunc = _mm256_round_ps(val, _MM_FROUND_TO_ZERO | _MM_FROUND_NO_EXC);
+                    auto frac = _mm256_andnot_ps(signMask, _mm256_sub_ps(val, trunc)); // Exact
+                    auto step = _mm256_or_ps(one, _mm256_and_ps(val, signMask));
+                    auto roundUp = _mm256_cmp_ps(frac, half, _CMP_GE_OQ);
+                    auto res = _mm256_add_ps(trunc, _mm256_and_ps(roundUp, step));
+                    // trunc + 0 is +0 for values in (-0.5, 0), the sign of the input is restored
+                    _mm256_storeu_ps(out + i, _mm256_or_ps(res, _mm256_and_ps(val, signMask)));
+                }
+                for (; i < size; ++i) {
+                    out[i] = std::round(in[i]);
+                }
+            }
+
+            /**
+             * Check all values for NaN.
+             * @param in the input values
+             * @param out true for all NaN values
+             * @param size the number of values
+             */
+            SI_TARGET_AVX2 static void isnan(const float *in, bool *out, std::size_t size) noexcept {
+                std::size_t i = 0;
+                for (; i + lanes <= size; i += lanes) {
+                    auto val = _mm256_loadu_ps(in + i);
+                    auto mask = static_cast<unsigned>(_mm256_movemask_ps(_mm256_cmp_ps(val, val, _CMP_UNORD_Q)));
+                    for (std::size_t lane = 0; lane < lanes; ++lane) {
+                        out[i + lane] = ((mask >> lane) & 1U) != 0;
+                    }
+                }
+                for (; i < size; ++i) {
+                    out[i] = std::isnan(in[i]);
+                }
+            }
+
+            /**
+             * Four quadrant arctangent of all pairs of values, calculated in double precision so the result is
+             * the correctly rounded float in almost all cases.
+             * @param y the y coordinates
+             * @param x the x coordinates
+             * @param out the angles
+             * @param size the number of values
+             */
+            SI_TARGET_AVX2 static void atan2(const float *y, const float *x, float *out, std::size_t size) noexcept {
+                constexpr std::size_t halfLanes = lanes / 2;
+                std::size_t i = 0;
+                for (; i + halfLanes <= size; i += halfLanes) {
+                    int special = 0;
+                    auto res = atan2Pd(_mm256_cvtps_pd(_mm_loadu_ps(y + i)), _mm256_cvtps_pd(_mm_loadu_ps(x + i)),
+                                       special);
+                    _mm_storeu_ps(out + i, _mm256_cvtpd_ps(res));
+                    if (special != 0) {
+                        for (std::size_t lane = 0; lane < halfLanes; ++lane) {
+                            out[i + lane] = std::atan2(y[i + lane], x[i + lane]);
+                        }
+                    }
+                }
+                for (; i < size; ++i) {
+                    out[i] = std::atan2(y[i], x[i]);
+                }
+            }
+        };
+#endif
+    } // namespace detail
+
+    /**
+     * Square root of all values, the unit rules are the same as for std::sqrt (all exponents need to be even).
+     * @tparam SiIn the (possibly const) SI type of the input
+     * @tparam SiOut the SI type of the output, the square root of SiIn
+     * @tparam ExtentIn the extent of the input
+     * @tparam ExtentOut the extent of the output
+     * @param in the input values
+     * @param out the square roots, needs to have the same size as in
+     */
+    template<typename SiIn, typename SiOut, std::size_t ExtentIn, std::size_t ExtentOut>
+    void sqrt(std::span<SiIn, ExtentIn> in, std::span<SiOut, ExtentOut> out) {
+        using In = std::remove_const_t<SiIn>;
+        static_assert(IsSi<In>::val && IsSi<SiOut>::val, "sqrt requires spans of SI values");
+        static_assert(In::meter % 2 == 0 && In::kilogram % 2 == 0 && In::second % 2 == 0 && In::ampere % 2 == 0 &&
+                              In::kelvin % 2 == 0 && In::mole % 2 == 0 && In::candela % 2 == 0,
+                      "sqrt not possible as resulting type has unit with non integer power of unit");
+        static_assert(std::is_same_v<decltype(std::sqrt(std::declval<In>())), SiOut>,
+                      "The output needs to have the unit sqrt(unit) and the same underlying type");
+        assert(in.size() == out.size() && "Input and output need to have the same size");
+#if SI_STL_BATCH_AVX2
+        if constexpr (detail::Avx2Kernels<typename In::type>::available) {
+            if (detail::hasAvx2()) {
+                detail::Avx2Kernels<typename In::type>::sqrt(asRaw(in).data(), asRaw(out).data(), in.size());
+                return;
+            }
+        }
+#endif
+        for (std::size_t i = 0; i < in.size(); ++i) {
+            out[i] = std::sqrt(in[i]);
+        }
+    }
+
+    /**
+     * Absolute value of all values, the unit is kept.
+     * @tparam SiIn the (possibly const) SI type of the input
+     * @tparam SiOut the SI type of the output, same as SiIn
+     * @tparam ExtentIn the extent of the input
+     * @tparam ExtentOut the extent of the output
+     * @param in the input values
+     * @param out the absolute values, needs to have the same size as in, may be the same as in
+     */
+    template<typename SiIn, typename SiOut, std::size_t ExtentIn, std::size_t ExtentOut>
+    void abs(std::span<SiIn, ExtentIn> in, std::span<SiOut, ExtentOut> out) {
+        using In = std::remove_const_t<SiIn>;
+        static_assert(IsSi<In>::val, "abs requires spans of SI values");
+        static_assert(std::is_same_v<In, SiOut>, "The output needs to have the same type as the input");
+        assert(in.size() == out.size() && "Input and output need to have the same size");
+#if SI_STL_BATCH_AVX2
+        if constexpr (detail::Avx2Kernels<typename In::type>::available) {
+            if (detail::hasAvx2()) {
+                detail::Avx2Kernels<typename In::type>::abs(asRaw(in).data(), asRaw(out).data(), in.size());
+                return;
+            }
+        }
+#endif
+        for (std::size_t i = 0; i < in.size(); ++i) {
+            out[i] = std::abs(in[i]);
+        }
+    }
+
+    /**
+     * Round all values to the nearest integer (halfway cases away from zero), the unit is kept.
+     * @tparam SiIn the (possibly const) SI type of the input
+     * @tparam SiOut the SI type of the output, same as SiIn
+     * @tparam ExtentIn the extent of the input
+     * @tparam ExtentOut the extent of the output
+     * @param in the input values
+     * @param out the rounded values, needs to have the same size as in, may be the same as in
+     */
+    template<typename SiIn, typename SiOut, std::size_t ExtentIn, std::size_t ExtentOut>
+    void round(std::span<SiIn, ExtentIn> in, std::span<SiOut, ExtentOut> out) {
+        using In = std::remove_const_t<SiIn>;
+        static_assert(IsSi<In>::val, "round requires spans of SI values");
+        static_assert(std::is_same_v<In, SiOut>, "The output needs to have the same type as the input");
+        assert(in.size() == out.size() && "Input and output need to have the same size");
+#if SI_STL_BATCH_AVX2
+        if constexpr (detail::Avx2Kernels<typename In::type>::available) {
+            if (detail::hasAvx2()) {
+                detail::Avx2Kernels<typename In::type>::round(asRaw(in).data(), asRaw(out).data(), in.size());
+                return;
+            }
+        }
+#endif
+        for (std::size_t i = 0; i < in.size(); ++i) {
+            out[i] = std::round(in[i]);
+        }
+    }
+
+    /**
+     * Check all values for NaN.
+     * @tparam SiIn the (possibly const) SI type of the input
+     * @tparam ExtentIn the extent of the input
+     * @tparam ExtentOut the extent of the output
+     * @param in the input values
+     * @param out true for all NaN values, needs to have the same size as in
+     */
+    template<typename SiIn, std::size_t ExtentIn, std::size_t ExtentOut>
+    void isnan(std::span<SiIn, ExtentIn> in, std::span<bool, ExtentOut> out) {
+        using In = std::remove_const_t<SiIn>;
+        static_assert(IsSi<In>::val, "isnan requires a span of SI values");
+        assert(in.size() == out.size() && "Input and output need to have the same size");
+#if SI_STL_BATCH_AVX2
+        if constexpr (detail::Avx2Kernels<typename In::type>::available) {
+            if (detail::hasAvx2()) {
+                detail::Avx2Kernels<typename In::type>::isnan(asRaw(in).data(), out.data(), in.size());
+                return;
+            }
+        }
+#endif
+        for (std::size_t i = 0; i < in.size(); ++i) {
+            out[i] = std::isnan(in[i]);
+        }
+    }
+
+    /**
+     * Four quadrant arctangent of all pairs of values, both inputs need to have the same unit. Special values
+     * (zeros, infinities and NaN) are handled exactly like by std::atan2. The AVX2 kernel for double is not bit
+     * identical to std::atan2 (and thus to the version without AVX2): the error is at most 2 ulp, about a quarter of
+     * random inputs differ from std::atan2 in the last bits. The kernel for float is calculated in double precision and
+     * returns the correctly rounded result in almost all cases.
+     * @tparam SiY the (possibly const) SI type of the y coordinates
+     * @tparam SiX the (possibly const) SI type of the x coordinates, same unit as SiY
+     * @tparam T the underlying type of the inputs
+     * @tparam ExtentY the extent of the y coordinates
+     * @tparam ExtentX the extent of the x coordinates
+     * @tparam ExtentOut the extent of the output
+     * @param y the y coordinates
+     * @param x the x coordinates, needs to have the same size as y
+     * @param out the unitless angles, needs to have the same size as y
+     */
+    template<typename SiY, typename SiX, typename T, std::size_t ExtentY, std::size_t ExtentX, std::size_t ExtentOut>
+    void atan2(std::span<SiY, ExtentY> y, std::span<SiX, ExtentX> x, std::span<T, ExtentOut> out) {
+        using Y = std::remove_const_t<SiY>;
+        static_assert(IsSi<Y>::val, "atan2 requires spans of SI values");
+        static_assert(std::is_same_v<Y, std::remove_const_t<SiX>>, "atan2 requires two arguments of the same unit");
+        static_assert(std::is_same_v<typename Y::type, T>, "The output needs to be of the underlying type");
+        assert(y.size() == x.size() && y.size() == out.size() && "All spans need to have the same size");
+#if SI_STL_BATCH_AVX2
+        if constexpr (detail::Avx2Kernels<T>::available) {
+            if (detail::hasAvx2()) {
+                detail::Avx2Kernels<T>::atan2(asRaw(y).data(), asRaw(x).data(), out.data(), y.size());
+                return;
+            }
+        }
+#endif
+        for (std::size_t i = 0; i < y.size(); ++i) {
+            out[i] = std::atan2(y[i], x[i]);
+        }
+    }
+} // namespace si
+
+#endif
@@ -0,0 +1,198 @@
+/**
+ * @file SiUnitString.hpp
+ * @author paul
+ * @date 17.10.26
+ * @brief Compile time generation of the textual representation of units.
+ * @ingroup SI
+ */
+#ifndef SI_SIUNITSTRING_HPP
+#define SI_SIUNITSTRING_HPP
+
+#include <cstddef>
+#include <string_view>
+
+#include "SiImpl.hpp"
+
+namespace si {
+    /**
+     * Custom name of a unit, by default there is no custom name and the unit is represented by its base units. Use
+     * the SI_CUSTOM_UNIT_NAME macro to specialize this type for a unit.
+     * @tparam m the meter exponent
+     * @tparam kg the kilogram exponent
+     * @tparam s the second exponent
+     * @tparam A the Ampere exponent
+     * @tparam K the Kelvin exponent
+     * @tparam MOL the Mol exponent
+     * @tparam CD the Candela exponent
+     */
+    template<int m, int kg, int s, int A, int K, int MOL, int CD>
+    struct UnitName {
+        static constexpr std::string_view name{}; ///< The custom name, empty if there is none
+    };
+
+    /**
+     * String of fixed length which can be created at compile time.
+     * @tparam N the number of characters (without terminating null character)
+     */
+    template<std::size_t N>
+    struct FixedString {
+        char data[N + 1]{}; ///< The characters, terminated by a null character
+
+        /**
+         * Access the string as string view.
+         * @return a view of all characters
+         */
+        [[nodiscard]] constexpr auto view() const -> std::string_view {
+            return std::string_view{data, N};
+        }
+
+        /**
+         * Access the string as null terminated C-String.
+         * @return pointer to the first character
+         */
+        [[nodiscard]] constexpr auto c_str() const -> const char * { // NOLINT(readability-identifier-naming)
+            return data;
+        }
+    };
+
+    namespace detail {
+        /**
+         * Names of the base units in the order of the template arguments of Si.
+         */
+        inline constexpr std::string_view baseUnitNames[] = {"m", "kg", "s", "A", "K", "Mol", "Cd"};
+
+        /**
+         * Number of characters required for printing an integer.
+         * @param val the integer
+         * @return the number of characters including the sign
+         */
+        constexpr auto intLength(int val) -> std::size_t {
+            std::size_t len = val < 0 ? 2 : 1;
+            for (auto abs = val < 0 ? -static_cast<long>(val) : static_cast<long>(val); abs >= 10; abs /= 10) {
+                ++len;
+            }
+            return len;
+        }
+
+        /**
+         * Number of characters required for printing a single base unit, this is " [unit]" for an exponent of 1,
+         * " / [unit]" for an exponent of -1 and " [unit]^[exp]" otherwise.
+         * @param exp the exponent
+         * @param name the name of the base unit
+         * @return the number of characters
+         */
+        constexpr auto baseUnitLength(int exp, std::string_view name) -> std::size_t {
+            if (exp == 0) {
+                return 0;
+            }
+            if (exp == 1) {
+                return 1 + name.size();
+            }
+            if (exp == -1) {
+                return 3 + name.size();
+            }
+            return 2 + name.size() + intLength(exp);
+        }
+
+        /**
+         * Append characters to a buffer.
+         * @param out the position in the buffer, is moved behind the written characters
+         * @param str the characters to write
+         */
+        constexpr void append(char *&out, std::string_view str) {
+            for (auto c : str) {
+                *out++ = c;
+            }
+        }
+
+        /**
+         * Write a single base unit, see baseUnitLength for the format.
+         * @param out the position in the buffer, is moved behind the written characters
+         * @param exp the exponent
+         * @param name the name of the base unit
+         */
+        constexpr void appendBaseUnit(char *&out, int exp, std::string_view name) {
+            if (exp == 0) {
+                return;
+            }
+            append(out, exp == -1 ? " / " : " ");
+            append(out, name);
+            if (exp != 1 && exp != -1) {
+                *out++ = '^';
+                if (exp < 0) {
+                    *out++ = '-';
+                }
+                auto abs = exp < 0 ? -static_cast<long>(exp) : static_cast<long>(exp);
+                char *end = out + intLength(exp) - (exp < 0 ? 1 : 0);
+                for (char *digit = end; digit != out; abs /= 10) {
+                    *--digit = static_cast<char>('0' + abs % 10);
+                }
+                out = end;
+            }
+        }
+
+        /**
+         * Number of characters of the textual representation of a unit.
+         * @tparam m the meter exponent
+         * @tparam kg the kilogram exponent
+         * @tparam s the second exponent
+         * @tparam A the Ampere exponent
+         * @tparam K the Kelvin exponent
+         * @tparam MOL the Mol exponent
+         * @tparam CD the Candela exponent
+         * @return the number of characters
+         */
+        template<int m, int kg, int s, int A, int K, int MOL, int CD>
+        constexpr auto unitStringLength() -> std::size_t {
+            constexpr auto custom = UnitName<m, kg, s, A, K, MOL, CD>::name;
+            if constexpr (not custom.empty()) {
+                return 1 + custom.size();
+            } else {
+                const int exps[] = {m, kg, s, A, K, MOL, CD};
+                std::size_t len = 0;
+                for (std::size_t i = 0; i < 7; ++i) {
+                    len += baseUnitLength(exps[i], baseUnitNames[i]);
+                }
+                return len;
+            }
+        }
+
+        /**
+         * Create the textual representation of a unit.
+         * @see unitString
+         */
+        template<int m, int kg, int s, int A, int K, int MOL, int CD>
+        constexpr auto makeUnitString() {
+            FixedString<unitStringLength<m, kg, s, A, K, MOL, CD>()> res{};
+            char *out = res.data;
+            constexpr auto custom = UnitName<m, kg, s, A, K, MOL, CD>::name;
+            if constexpr (not custom.empty()) {
+                append(out, " ");
+                append(out, custom);
+            } else {
+                const int exps[] = {m, kg, s, A, K, MOL, CD};
+                for (std::size_t i = 0; i < 7; ++i) {
+                    appendBaseUnit(out, exps[i], baseUnitNames[i]);
+                }
+            }
+            return res;
+        }
+    } // namespace detail
+
+    /**
+     * Textual representation of a unit which is appended to the value when printing, the string is created at
+     * compile time. If a custom name is registered (see SI_CUSTOM_UNIT_NAME) this is a space followed by the custom
+     * name, otherwise it is the list of base units with their exponents, for example " m^2 kg s^-3".
+     * @tparam m the meter exponent
+     * @tparam kg the kilogram exponent
+     * @tparam s the second exponent
+     * @tparam A the Ampere exponent
+     * @tparam K the Kelvin exponent
+     * @tparam MOL the Mol exponent
+     * @tparam CD the Candela exponent
+     */
+    template<int m, int kg, int s, int A, int K, int MOL, int CD>
+    constexpr auto unitString = detail::makeUnitString<m, kg, s, A, K, MOL, CD>();
+} // namespace si
+
+#endif
@@ -0,0 +1,314 @@
+/**
+ * @file SiWire.hpp
+ * @author paul
+ * @date 17.10.26
+ * @brief Compact binary encoding of SI values and batches of SI values, including a descriptor of the unit.
+ * Requires C++20.
+ * @ingroup SI
+ */
+#ifndef SI_SIWIRE_HPP
+#define SI_SIWIRE_HPP
+
+#include <algorithm>
+#include <bit>
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <optional>
+#include <span>
+#include <type_traits>
+
+#include "SiDynamic.hpp"
+#include "SiImpl.hpp"
+#include "SiSpan.hpp"
+
+namespace si {
+    namespace detail {
+        /**
+         * Size of the descriptor preceding every encoded value or batch.
+         */
+        constexpr std::size_t descriptorSize = 8;
+
+        /**
+         * Size of the header of an encoded batch: descriptor, 32 bit count and 32 bit reserved (zero). The header
+         * is a multiple of 8 bytes so the values of a batch are aligned if the buffer is aligned.
+         */
+        constexpr std::size_t batchHeaderSize = 16;
+
+        /**
+         * Create the code of an underlying type, see typeCode. Only types which are represented identically on all
+         * platforms are accepted: IEEE 754 single and double precision and integers without padding bits, all with
+         * a size below 16 bytes (so that the size fits into a nibble). bool is rejected, it would have the same code
+         * as an 8 bit unsigned integer and decoding any other value than 0 or 1 into a bool is undefined.
+         * @tparam T the underlying type
+         * @return the code
+         */
+        template<typename T>
+        constexpr auto makeTypeCode() -> std::uint8_t {
+            static_assert(std::is_arithmetic_v<T>, "Only arithmetic types can be encoded");
+            static_assert(not std::is_same_v<T, bool>, "bool can not be encoded");
+            static_assert(sizeof(T) < 16, "The size of the type does not fit into the type code");
+            if constexpr (std::is_floating_point_v<T>) {
+                static_assert(std::numeric_limits<T>::is_iec559 &&
+                                      std::numeric_limits<T>::digits == (sizeof(T) == 4 ? 24 : sizeof(T) == 8 ? 53 : 0),
+                              "Only IEEE 754 single and double precision values can be encoded");
+            } else {
+                static_assert(std::has_unique_object_representations_v<T>,
+                              "Types with padding bits can not be encoded");
+            }
+            return static_cast<std::uint8_t>((std::is_floating_point_v<T> ? 1U : std::is_signed_v<T> ? 2U : 3U) << 4U |
+                                             sizeof(T));
+        }
+
+        /**
+         * Code of the underlying type as stored in the most significant byte of the descriptor: the kind
+         * (1: floating point, 2: signed integer, 3: unsigned integer) in the upper nibble and the size in bytes in
+         * the lower nibble.
+         * @tparam T the underlying type
+         */
+        template<typename T>
+        constexpr std::uint8_t typeCode = makeTypeCode<T>();
+
+        /**
+         * Checks whether values can be copied from and to the wire as they are.
+         */
+        constexpr bool nativeIsWire = std::endian::native == std::endian::little;
+
+        /**
+         * Copy the little endian representation of a value into a buffer.
+         * @tparam T the type of the value
+         * @param val the value
+         * @param out the begin of the buffer, needs to provide at least sizeof(T) bytes
+         */
+        template<typename T>
+        void storeLittle(T val, std::byte *out) noexcept {
+            std::memcpy(out, &val, sizeof(T));
+            if constexpr (not nativeIsWire) {
+                std::reverse(out, out + sizeof(T));
+            }
+        }
+
+        /**
+         * Read a value from its little endian representation, the buffer does not need to be aligned.
+         * @tparam T the type of the value
+         * @param in the begin of the buffer, needs to provide at least sizeof(T) bytes
+         * @return the value
+         */
+        template<typename T>
+        auto loadLittle(const std::byte *in) noexcept -> T {
+            std::byte bytes[sizeof(T)];
+            std::memcpy(bytes, in, sizeof(T));
+            if constexpr (not nativeIsWire) {
+                std::reverse(bytes, bytes + sizeof(T));
+            }
+            return std::bit_cast<T>(bytes);
+        }
+    } // namespace detail
+
+    /**
+     * Descriptor of an SI type as written in front of every encoded value or batch: the exponents of the unit
+     * (see Dimension) in the lower seven bytes and the code of the underlying type in the most significant byte.
+     * @tparam SiT the SI type
+     */
+    template<typename SiT>
+    constexpr std::uint64_t wireDescriptor =
+            Dimension::of<SiT>().packed() | std::uint64_t{detail::typeCode<typename SiT::type>} << 56U;
+
+    /**
+     * Number of bytes required for encoding a single value.
+     * @tparam SiT the SI type
+     */
+    template<typename SiT>
+    constexpr std::size_t encodedSize = detail::descriptorSize + sizeof(typename SiT::type);
+
+    /**
+     * Number of bytes required for encoding a batch of values.
+     * @tparam SiT the SI type
+     * @param count the number of values
+     * @return the size of the encoded batch in bytes
+     */
+    template<typename SiT>
+    constexpr auto encodedBatchSize(std::size_t count) noexcept -> std::size_t {
+        return detail::batchHeaderSize + count * sizeof(typename SiT::type);
+    }
+
+    /**
+     * Encode a single value, the descriptor is followed by the value, both are little endian.
+     * @tparam m the meter exponent
+     * @tparam kg the kilogram exponent
+     * @tparam s the second exponent
+     * @tparam A the Ampere exponent
+     * @tparam K the Kelvin exponent
+     * @tparam MOL the Mol exponent
+     * @tparam CD the Candela exponent
+     * @tparam T the underlying numerical type
+     * @param si the value
+     * @param out the buffer, no alignment is required
+     * @return the number of bytes written or 0 if the buffer is too small
+     */
+    template<int m, int kg, int s, int A, int K, int MOL, int CD, typename T>
+    auto encode(Si<m, kg, s, A, K, MOL, CD, T> si, std::span<std::byte> out) noexcept -> std::size_t {
+        using SiT = Si<m, kg, s, A, K, MOL, CD, T>;
+        static_assert(std::is_arithmetic_v<T>, "Only SI types with an arithmetic underlying type can be encoded");
+        if (out.size() < encodedSize<SiT>) {
+            return 0;
+        }
+        detail::storeLittle(wireDescriptor<SiT>, out.data());
+        detail::storeLittle(static_cast<T>(si), out.data() + detail::descriptorSize);
+        return encodedSize<SiT>;
+    }
+
+    /**
+     * Decode a single value encoded by encode.
+     * @tparam SiT the expected SI type
+     * @param in the buffer, no alignment is required
+     * @return the value or std::nullopt if the buffer is too small or the unit or type does not match
+     */
+    template<typename SiT>
+    auto decode(std::span<const std::byte> in) noexcept -> std::optional<SiT> {
+        using T = typename SiT::type;
+        static_assert(IsSi<SiT>::val, "decode requires an SI type");
+        if (in.size() < encodedSize<SiT> || detail::loadLittle<std::uint64_t>(in.data()) != wireDescriptor<SiT>) {
+            return std::nullopt;
+        }
+        return SiT{detail::loadLittle<T>(in.data() + detail::descriptorSize)};
+    }
+
+    /**
+     * Encode a batch of values: the descriptor, the number of values as 32 bit integer, four reserved bytes and all
+     * values, everything little endian. On little endian machines the values are copied as a single block.
+     * @tparam SiT the (possibly const) SI type
+     * @tparam Extent the extent of the span
+     * @param values the values, at most 2^32 - 1
+     * @param out the buffer, no alignment is required
+     * @return the number of bytes written or 0 if the buffer is too small or there are too many values
+     */
+    template<typename SiT, std::size_t Extent>
+    auto encodeBatch(std::span<SiT, Extent> values, std::span<std::byte> out) noexcept -> std::size_t {
+        using T = typename std::remove_const_t<SiT>::type;
+        static_assert(std::is_arithmetic_v<T>, "Only SI types with an arithmetic underlying type can be encoded");
+        const auto size = encodedBatchSize<std::remove_const_t<SiT>>(values.size());
+        if (out.size() < size || values.size() > UINT32_MAX) {
+            return 0;
+        }
+        detail::storeLittle(wireDescriptor<std::remove_const_t<SiT>>, out.data());
+        detail::storeLittle(static_cast<std::uint32_t>(values.size()), out.data() + detail::descriptorSize);
+        detail::storeLittle(std::uint32_t{0}, out.data() + detail::descriptorSize + 4);
+        auto *payload = out.data() + detail::batchHeaderSize;
+        if constexpr (detail::nativeIsWire) {
+            if (not values.empty()) {
+                std::memcpy(payload, values.data(), values.size_bytes());
+            }
+        } else {
+            for (std::size_t i = 0; i < values.size(); ++i) {
+                detail::storeLittle(static_cast<T>(values[i]), payload + i * sizeof(T));
+            }
+        }
+        return size;
+    }
+
+    /**
+     * Read-only view of the values of a batch in a received buffer as returned by decodeBatch, no values are copied.
+     * @tparam SiT the SI type
+     */
+    template<typename SiT>
+    class WireBatch {
+        using T = typename SiT::type;
+
+      public:
+        /**
+         * Create a view of encoded values.
+         * @param payload the begin of the values
+         * @param count the number of values
+         */
+        WireBatch(const std::byte *payload, std::size_t count) noexcept : payload{payload}, count{count} {
+        }
+
+        /**
+         * Number of values in the batch.
+         * @return the number of values
+         */
+        [[nodiscard]] auto size() const noexcept -> std::size_t {
+            return count;
+        }
+
+        /**
+         * Checks whether the batch is empty.
+         * @return true if there are no values
+         */
+        [[nodiscard]] auto empty() const noexcept -> bool {
+            return count == 0;
+        }
+
+        /**
+         * Read a single value, this is a plain (possibly unaligned) load on little endian machines.
+         * @param i the index of the value
+         * @return the value
+         */
+        auto operator[](std::size_t i) const noexcept -> SiT {
+            return SiT{detail::loadLittle<T>(payload + i * sizeof(T))};
+        }
+
+        /**
+         * Access the values in-place, this is only possible on little endian machines if the values are aligned.
+         * @return a span referencing the buffer or std::nullopt if the values can not be accessed in-place
+         */
+        [[nodiscard]] auto span() const noexcept -> std::optional<std::span<const SiT>> {
+            if constexpr (detail::nativeIsWire) {
+                // NOLINTNEXTLINE(cppcoreguidelines-pro-type-reinterpret-cast) only used for the alignment check
+                if (reinterpret_cast<std::uintptr_t>(payload) % alignof(SiT) == 0) {
+                    return fromBytes<SiT>(std::span<const std::byte>{payload, count * sizeof(T)});
+                }
+            }
+            return std::nullopt;
+        }
+
+        /**
+         * Copy all values, on little endian machines this is a single block copy.
+         * @param out the destination, needs to have the same size as the batch
+         */
+        void copyTo(std::span<SiT> out) const noexcept {
+            assert(out.size() == count && "Size of the destination does not match the size of the batch");
+            if constexpr (detail::nativeIsWire) {
+                if (count != 0) {
+                    std::memcpy(out.data(), payload, count * sizeof(T));
+                }
+            } else {
+                for (std::size_t i = 0; i < count; ++i) {
+                    out[i] = (*this)[i];
+                }
+            }
+        }
+
+      private:
+        const std::byte *payload;
+        std::size_t count;
+    };
+
+    /**
+     * Decode a batch encoded by encodeBatch. The descriptor is checked once, the values are not copied but accessed
+     * through the returned view which references the buffer.
+     * @tparam SiT the expected SI type
+     * @param in the buffer, if it is aligned for the underlying type the values can be accessed in-place
+     * @return a view of the values or std::nullopt if the buffer is too small, the unit or type does not match or the
+     *      reserved bytes are not zero (these are reserved for future extensions)
+     */
+    template<typename SiT>
+    auto decodeBatch(std::span<const std::byte> in) noexcept -> std::optional<WireBatch<SiT>> {
+        static_assert(IsSi<SiT>::val, "decodeBatch requires an SI type");
+        if (in.size() < detail::batchHeaderSize ||
+            detail::loadLittle<std::uint64_t>(in.data()) != wireDescriptor<SiT>) {
+            return std::nullopt;
+        }
+        const auto count = detail::loadLittle<std::uint32_t>(in.data() + detail::descriptorSize);
+        const auto reserved = detail::loadLittle<std::uint32_t>(in.data() + detail::descriptorSize + 4);
+        if (reserved != 0 || in.size() < encodedBatchSize<SiT>(count)) {
+            return std::nullopt;
+        }
+        return WireBatch<SiT>{in.data() + detail::batchHeaderSize, count};
+    }
+} // namespace si
+
+#endif
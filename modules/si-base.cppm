@@ -0,0 +1,21 @@
+/**
+ * @file si-base.cppm
+ * @author paul
+ * @date 17.10.26
+ * @brief Module partition containing the implementation of the SI type and the base units.
+ * @ingroup SI
+ */
+module;
+
+#include <type_traits>
+#include <utility>
+
+// Only provides the macros used for generating the units
+#include <SI/SiGenerator.hpp>
+
+export module si:base;
+
+export {
+#include <SI/SiImpl.hpp>
+#include <SI/SiBase.hpp>
+}
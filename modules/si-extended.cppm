@@ -0,0 +1,26 @@
+/**
+ * @file si-extended.cppm
+ * @author paul
+ * @date 17.10.26
+ * @brief Module partition containing the extended units.
+ * @ingroup SI
+ */
+module;
+
+#include <iostream>
+#include <type_traits>
+#include <utility>
+
+// Only provides the macros used for generating the units
+#include <SI/SiGenerator.hpp>
+
+export module si:extended;
+
+export import :base;
+
+// Already provided by :base, the include guard prevents a second definition
+#define SI_SIIMPL_HPP
+
+export {
+#include <SI/SiExtended.hpp>
+}
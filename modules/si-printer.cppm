@@ -0,0 +1,45 @@
+/**
+ * @file si-printer.cppm
+ * @author paul
+ * @date 17.10.26
+ * @brief Module partition containing the printer (operator<<) and, if available, the std::format support.
+ * @ingroup SI
+ */
+module;
+
+#include <algorithm>
+#include <cstddef>
+#include <iostream>
+#include <sstream>
+#include <string_view>
+#include <type_traits>
+#include <utility>
+
+#if __has_include(<format>)
+    #include <format>
+#endif
+
+// Only provides the macros used for generating the units
+#include <SI/SiGenerator.hpp>
+
+export module si:printer;
+
+export import :base;
+export import :extended;
+
+// Already provided by :base and :extended, the include guards prevent a second definition
+#define SI_SIIMPL_HPP
+#define SI_SIEXTENDED_HPP
+
+// The names are registered below, explicit specializations can not be exported
+#define SI_SIPRINTEREXTENDED_HPP
+
+export {
+#include <SI/SiUnitString.hpp>
+#include <SI/SiPrinter.hpp>
+}
+
+// Only specializations, these are reachable without being exported
+#undef SI_SIPRINTEREXTENDED_HPP
+#include <SI/SiPrinterExtended.hpp>
+#include <SI/SiFormat.hpp>
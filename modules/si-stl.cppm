@@ -0,0 +1,23 @@
+/**
+ * @file si-stl.cppm
+ * @author paul
+ * @date 17.10.26
+ * @brief Module partition containing the overloads of the mathematical functions of the standard library.
+ * @ingroup SI
+ */
+module;
+
+#include <cmath>
+#include <type_traits>
+#include <utility>
+
+export module si:stl;
+
+export import :base;
+
+// Already provided by :base, the include guard prevents a second definition
+#define SI_SIIMPL_HPP
+
+export {
+#include <SI/SiStl.hpp>
+}
@@ -0,0 +1,30 @@
+/**
+ * @file si.cppm
+ * @author paul
+ * @date 17.10.26
+ * @brief Primary module interface, "import si;" provides the same declarations as including Si.hpp. Macros can not
+ * be exported by a module, for creating custom units include SiGenerator.hpp in addition to importing the module.
+ * @ingroup SI
+ */
+module;
+
+// All standard library headers used by the partitions, see the global module fragments of the partitions
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <iostream>
+#include <sstream>
+#include <string_view>
+#include <type_traits>
+#include <utility>
+
+#if __has_include(<format>)
+    #include <format>
+#endif
+
+export module si;
+
+export import :base;
+export import :extended;
+export import :printer;
+export import :stl;
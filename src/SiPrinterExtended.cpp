@@ -1,9 +0,0 @@
-/**
- * @file SiPrinterExtended.cpp
- * @author paul
- * @date 14.07.20
- * @brief Translation units for implementations of custom pretty printers.
- */
-#include "SI/SiPrinterExtended.hpp"
-
-SI_CUSTOM_PRINTER_IMPL(Volt, "V")
@@ -0,0 +1,74 @@
+# Compares the number of instructions of all kernels (functions starting with "kernel") in two object files, fails if
+# a kernel in SI_OBJECT has more instructions than the kernel with the same name in RAW_OBJECT.
+#
+# Usage: cmake -DOBJDUMP=<objdump> -DSI_OBJECT=<object> -DRAW_OBJECT=<object> -P CompareCodegen.cmake
+
+cmake_minimum_required(VERSION 3.12)
+
+foreach (var OBJDUMP SI_OBJECT RAW_OBJECT)
+    if (NOT DEFINED ${var})
+        message(FATAL_ERROR "${var} is not set")
+    endif ()
+endforeach ()
+
+# Sets <prefix>_FUNCTIONS to the list of all kernels and <prefix>_<function> to the number of instructions,
+# padding (nop) is ignored and cold parts of a function (e.g. "kernel.cold") are counted for the function.
+function(count_instructions object prefix)
+    execute_process(COMMAND ${OBJDUMP} -d --no-show-raw-insn ${object}
+            OUTPUT_VARIABLE disassembly
+            RESULT_VARIABLE result)
+    if (NOT result EQUAL 0)
+        message(FATAL_ERROR "Failed to disassemble ${object}")
+    endif ()
+
+    string(REPLACE ";" "\;" disassembly "${disassembly}")
+    string(REPLACE "\n" ";" lines "${disassembly}")
+    set(functions "")
+    set(current "")
+    foreach (line IN LISTS lines)
+        if (line MATCHES "^[0-9a-f]+ <([A-Za-z_][A-Za-z0-9_]*)(\\.[A-Za-z0-9_.]+)?>:$")
+            set(current ${CMAKE_MATCH_1})
+            if (NOT current MATCHES "^kernel")
+                set(current "")
+            elseif (NOT current IN_LIST functions)
+                list(APPEND functions ${current})
+                set(count_${current} 0)
+            endif ()
+        elseif (current AND line MATCHES "^ +[0-9a-f]+:\t(.*)$")
+            if (NOT CMAKE_MATCH_1 MATCHES "nop|xchg +%ax,%ax|int3|^\\(bad\\)")
+                math(EXPR count_${current} "${count_${current}} + 1")
+            endif ()
+        endif ()
+    endforeach ()
+
+    set(${prefix}_FUNCTIONS ${functions} PARENT_SCOPE)
+    foreach (function IN LISTS functions)
+        set(${prefix}_${function} ${count_${function}} PARENT_SCOPE)
+    endforeach ()
+endfunction()
+
+count_instructions(${SI_OBJECT} SI)
+count_instructions(${RAW_OBJECT} RAW)
+
+if (NOT SI_FUNCTIONS)
+    message(FATAL_ERROR "No functions found in ${SI_OBJECT}")
+endif ()
+
+set(failed "")
+foreach (function IN LISTS SI_FUNCTIONS)
+    if (NOT function IN_LIST RAW_FUNCTIONS)
+        message(SEND_ERROR "${function}: no reference implementation")
+        continue()
+    endif ()
+    if (SI_${function} GREATER RAW_${function})
+        set(status "FAILED")
+        list(APPEND failed ${function})
+    else ()
+        set(status "ok")
+    endif ()
+    message(STATUS "${function}: ${SI_${function}} instructions (raw: ${RAW_${function}}) ${status}")
+endforeach ()
+
+if (failed)
+    message(FATAL_ERROR "SI version has more instructions than the raw version: ${failed}")
+endif ()
@@ -0,0 +1,134 @@
+/**
+ * @file KernelsRaw.cpp
+ * @author paul
+ * @date 17.10.26
+ * @brief Kernels using double, reference for the generated code of the kernels on SI types (see KernelsSi.cpp).
+ * @ingroup SI
+ */
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+
+extern "C" {
+auto kernelAdd(double lhs, double rhs) -> double {
+    return lhs + rhs;
+}
+
+auto kernelSub(double lhs, double rhs) -> double {
+    return lhs - rhs;
+}
+
+auto kernelNeg(double val) -> double {
+    return -val;
+}
+
+auto kernelMulScalar(double lhs, double rhs) -> double {
+    return lhs * rhs;
+}
+
+auto kernelDivScalar(double lhs, double rhs) -> double {
+    return lhs / rhs;
+}
+
+auto kernelScalarMul(double lhs, double rhs) -> double {
+    return lhs * rhs;
+}
+
+auto kernelScalarDiv(double lhs, double rhs) -> double {
+    return lhs / rhs;
+}
+
+auto kernelMul(double lhs, double rhs) -> double {
+    return lhs * rhs;
+}
+
+auto kernelDiv(double lhs, double rhs) -> double {
+    return lhs / rhs;
+}
+
+auto kernelCompound(double val, double offset, double factor) -> double {
+    val += offset;
+    val *= factor;
+    val -= offset;
+    val /= factor;
+    return val;
+}
+
+auto kernelLess(double lhs, double rhs) -> bool {
+    return lhs < rhs;
+}
+
+auto kernelEqual(double lhs, double rhs) -> bool {
+    return lhs == rhs;
+}
+
+auto kernelGreaterEqual(double lhs, double rhs) -> bool {
+    return lhs >= rhs;
+}
+
+auto kernelSqrt(double x, double y) -> double {
+    return std::sqrt(x * x + y * y);
+}
+
+auto kernelAtan2(double y, double x) -> double {
+    return std::atan2(y, x);
+}
+
+auto kernelLiteral(double val) -> double {
+    return (val + static_cast<double>(1.5L * 1E3L)) / static_cast<double>(2.0L);
+}
+
+void kernelAxpy(const double *x, const double *y, double *out, std::size_t n, double factor) {
+    for (std::size_t i = 0; i < n; ++i) {
+        out[i] = factor * x[i] + y[i];
+    }
+}
+
+void kernelSpeed(const double *distance, const double *time, double *out, std::size_t n) {
+    for (std::size_t i = 0; i < n; ++i) {
+        out[i] = distance[i] / time[i];
+    }
+}
+
+auto kernelDot(const double *x, const double *y, std::size_t n) -> double {
+    double sum = 0;
+    for (std::size_t i = 0; i < n; ++i) {
+        sum += x[i] * y[i];
+    }
+    return sum;
+}
+
+auto kernelFromDuration(std::int64_t duration) -> double {
+    return static_cast<double>(duration) / 1e9;
+}
+
+auto kernelToDuration(double second) -> std::int64_t {
+    return static_cast<std::int64_t>(second * 1e6);
+}
+
+auto kernelFma(double a, double b, double c) -> double {
+    return std::fma(a / b, b, c);
+}
+
+auto kernelPow(double val) -> double {
+    return val * val * val;
+}
+
+auto kernelHypot(double x, double y) -> double {
+    return std::hypot(x, y);
+}
+
+void kernelMatVec(const double *transition, const double *state, double *out) {
+    double res[2] = {transition[0] * state[0] + transition[1] * state[1],
+                     transition[2] * state[0] + transition[3] * state[1]};
+    out[0] = res[0];
+    out[1] = res[1];
+}
+
+void kernelBatchAxpy(const double *x, const double *y, double *out, double factor) {
+    double res[3] = {x[0] * factor + y[0], x[1] * factor + y[1], x[2] * factor + y[2]};
+    out[0] = res[0];
+    out[1] = res[1];
+    out[2] = res[2];
+}
+}
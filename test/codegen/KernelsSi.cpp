@@ -0,0 +1,148 @@
+/**
+ * @file KernelsSi.cpp
+ * @author paul
+ * @date 17.10.26
+ * @brief Kernels using SI types, the generated code is compared to the same kernels on double (see KernelsRaw.cpp).
+ * @ingroup SI
+ */
+#include <chrono>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+
+#include <SI/SiBase.hpp>
+#include <SI/SiChrono.hpp>
+#include <SI/SiExtended.hpp>
+#include <SI/SiMatrix.hpp>
+#include <SI/SiStl.hpp>
+
+#if __cplusplus >= 202002L
+    #include <SI/SiBatch.hpp>
+#endif
+
+using namespace si::literals;
+
+using State = si::Vec<si::Meter<>, si::Speed<>>;
+using Transition =
+        si::Mat<si::Units<si::Meter<>, si::Speed<>>, si::Units<si::Si<-1, 0, 0, 0, 0, 0, 0>, si::Si<-1, 0, 1, 0, 0, 0, 0>>>;
+
+extern "C" {
+auto kernelAdd(si::Meter<> lhs, si::Meter<> rhs) -> double {
+    return static_cast<double>(lhs + rhs);
+}
+
+auto kernelSub(si::Meter<> lhs, si::Meter<> rhs) -> double {
+    return static_cast<double>(lhs - rhs);
+}
+
+auto kernelNeg(si::Meter<> val) -> double {
+    return static_cast<double>(-val);
+}
+
+auto kernelMulScalar(si::Meter<> lhs, double rhs) -> double {
+    return static_cast<double>(lhs * rhs);
+}
+
+auto kernelDivScalar(si::Meter<> lhs, double rhs) -> double {
+    return static_cast<double>(lhs / rhs);
+}
+
+auto kernelScalarMul(double lhs, si::Meter<> rhs) -> double {
+    return static_cast<double>(lhs * rhs);
+}
+
+auto kernelScalarDiv(double lhs, si::Second<> rhs) -> double {
+    return static_cast<double>(lhs / rhs);
+}
+
+auto kernelMul(si::Meter<> lhs, si::Meter<> rhs) -> double {
+    return static_cast<double>(lhs * rhs);
+}
+
+auto kernelDiv(si::Meter<> lhs, si::Second<> rhs) -> double {
+    return static_cast<double>(lhs / rhs);
+}
+
+auto kernelCompound(si::Meter<> val, si::Meter<> offset, double factor) -> double {
+    val += offset;
+    val *= factor;
+    val -= offset;
+    val /= factor;
+    return static_cast<double>(val);
+}
+
+auto kernelLess(si::Meter<> lhs, si::Meter<> rhs) -> bool {
+    return lhs < rhs;
+}
+
+auto kernelEqual(si::Meter<> lhs, si::Meter<> rhs) -> bool {
+    return lhs == rhs;
+}
+
+auto kernelGreaterEqual(si::Meter<> lhs, si::Meter<> rhs) -> bool {
+    return lhs >= rhs;
+}
+
+auto kernelSqrt(si::Meter<> x, si::Meter<> y) -> double {
+    return static_cast<double>(std::sqrt(x * x + y * y));
+}
+
+auto kernelAtan2(si::Meter<> y, si::Meter<> x) -> double {
+    return std::atan2(y, x);
+}
+
+auto kernelLiteral(si::Meter<> val) -> double {
+    return static_cast<double>((val + 1.5_k_meter) / 2_second);
+}
+
+void kernelAxpy(const si::Meter<> *x, const si::Meter<> *y, si::Meter<> *out, std::size_t n, double factor) {
+    for (std::size_t i = 0; i < n; ++i) {
+        out[i] = factor * x[i] + y[i];
+    }
+}
+
+void kernelSpeed(const si::Meter<> *distance, const si::Second<> *time, si::Speed<> *out, std::size_t n) {
+    for (std::size_t i = 0; i < n; ++i) {
+        out[i] = distance[i] / time[i];
+    }
+}
+
+auto kernelDot(const si::Meter<> *x, const si::Meter<> *y, std::size_t n) -> double {
+    auto sum = 0_meter * 0_meter;
+    for (std::size_t i = 0; i < n; ++i) {
+        sum += x[i] * y[i];
+    }
+    return static_cast<double>(sum);
+}
+
+auto kernelFromDuration(std::chrono::nanoseconds duration) -> double {
+    return static_cast<double>(si::toSecond(duration));
+}
+
+auto kernelToDuration(si::Second<> second) -> std::int64_t {
+    return si::toDuration<std::chrono::microseconds>(second).count();
+}
+
+auto kernelFma(si::Meter<> a, si::Second<> b, si::Meter<> c) -> double {
+    return static_cast<double>(std::fma(a / b, b, c));
+}
+
+auto kernelPow(si::Meter<> val) -> double {
+    return static_cast<double>(si::pow<3>(val));
+}
+
+auto kernelHypot(si::Meter<> x, si::Meter<> y) -> double {
+    return static_cast<double>(std::hypot(x, y));
+}
+
+void kernelMatVec(const Transition &transition, const State &state, State *out) {
+    *out = transition * state;
+}
+
+#if __cplusplus >= 202002L
+void kernelBatchAxpy(const double *x, const double *y, double *out, double factor) {
+    using Batch = si::Batch<si::Meter<>, 3>;
+    (Batch::loadRaw(x) * factor + Batch::loadRaw(y)).storeRaw(out);
+}
+#endif
+}
@@ -0,0 +1,38 @@
+/**
+ * @file ImportTest.cpp
+ * @author paul
+ * @date 18.10.26
+ * @brief Test of the module si: the declarations of the library are available using "import si;", values are printed
+ * and formatted with their unit.
+ * @ingroup SI
+ */
+#include <sstream>
+#include <string>
+
+#if __has_include(<format>)
+    #include <format>
+#endif
+
+#include "../unit/Check.hpp"
+
+import si;
+
+auto main() -> int {
+    using namespace si::literals;
+
+    auto speed = 10_meter / 1_second;
+    std::stringstream stream;
+    stream << speed;
+    SI_CHECK(stream.str() == "10 m / s");
+
+    // Custom unit names are exported by the module as well
+    stream.str("");
+    stream << si::Volt<>{1};
+    SI_CHECK(stream.str() == "1 V");
+
+#if __cpp_lib_format
+    SI_CHECK(std::format("{:.2f}", 10_meter / 4_second) == "2.50 m / s");
+#endif
+
+    return si::test::result();
+}
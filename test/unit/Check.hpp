@@ -0,0 +1,51 @@
+/**
+ * @file Check.hpp
+ * @author paul
+ * @date 18.10.26
+ * @brief Minimal checks for the unit tests, unlike assert the checks are also evaluated in release builds. Every
+ * failed check is reported, the test fails if any check failed.
+ * @ingroup SI
+ */
+#ifndef SI_TEST_CHECK_HPP
+#define SI_TEST_CHECK_HPP
+
+#include <cstdio>
+
+namespace si::test {
+    /**
+     * Number of failed checks.
+     */
+    inline int failures = 0;
+
+    /**
+     * Report a failed check.
+     * @param cond the result of the check
+     * @param expr the checked expression
+     * @param file the file of the check
+     * @param line the line of the check
+     */
+    inline void check(bool cond, const char *expr, const char *file, int line) {
+        if (not cond) {
+            std::fprintf(stderr, "%s:%d: check failed: %s\n", file, line, expr);
+            ++failures;
+        }
+    }
+
+    /**
+     * Exit code of the test.
+     * @return 0 if all checks passed, 1 otherwise
+     */
+    inline auto result() -> int {
+        if (failures != 0) {
+            std::fprintf(stderr, "%d check(s) failed\n", failures);
+        }
+        return failures == 0 ? 0 : 1;
+    }
+} // namespace si::test
+
+/**
+ * Check a condition, the test continues if the check fails.
+ */
+#define SI_CHECK(...) si::test::check(static_cast<bool>(__VA_ARGS__), #__VA_ARGS__, __FILE__, __LINE__) // NOLINT
+
+#endif
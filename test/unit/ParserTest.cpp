@@ -0,0 +1,114 @@
+/**
+ * @file ParserTest.cpp
+ * @author paul
+ * @date 18.10.26
+ * @brief Tests of SiParser.hpp: everything printed by operator<< can be parsed again, prefixes and custom names are
+ * resolved and values which do not fit into the underlying type are rejected.
+ * @ingroup SI
+ */
+#include <cstdint>
+#include <sstream>
+#include <string>
+#include <string_view>
+#include <system_error>
+
+#include <SI/SiBase.hpp>
+#include <SI/SiExtended.hpp>
+#include <SI/SiParser.hpp>
+#include <SI/SiPrinter.hpp>
+
+#include "Check.hpp"
+
+/**
+ * Parse a complete string.
+ * @tparam SiT the expected type
+ * @param str the string
+ * @param value the parsed value
+ * @return the error code, std::errc::invalid_argument if not all characters were parsed
+ */
+template<typename SiT>
+auto parse(std::string_view str, SiT &value) -> std::errc {
+    auto [ptr, ec] = si::from_chars(str.data(), str.data() + str.size(), value);
+    if (ec == std::errc{} && ptr != str.data() + str.size()) {
+        return std::errc::invalid_argument;
+    }
+    return ec;
+}
+
+/**
+ * Print a value using operator<< and check that parsing the output results in the same value.
+ * @tparam SiT the SI type
+ * @param value the value, needs to be printed exactly (i.e. with at most six significant digits)
+ */
+template<typename SiT>
+void checkRoundTrip(SiT value) {
+    std::ostringstream stream;
+    stream << value;
+    SiT parsed{};
+    auto ec = parse(stream.str(), parsed);
+    SI_CHECK(ec == std::errc{});
+    SI_CHECK(parsed == value);
+    if (ec != std::errc{} || parsed != value) {
+        std::fprintf(stderr, "  round trip of \"%s\"\n", stream.str().c_str());
+    }
+}
+
+/**
+ * Round trip of a unit with floating point and integer underlying types.
+ * @tparam Unit the unit, a template taking the underlying type
+ */
+template<template<typename> typename Unit>
+void checkRoundTrips() {
+    checkRoundTrip(Unit<double>{1.5});
+    checkRoundTrip(Unit<double>{-2.5e-7});
+    checkRoundTrip(Unit<float>{-0.25F});
+    checkRoundTrip(Unit<int>{42});
+    checkRoundTrip(Unit<std::int64_t>{-1234567});
+    checkRoundTrip(Unit<unsigned>{7U});
+}
+
+#define SI_CHECK_ROUND_TRIPS(Name, literal, m, kg, s, A, K, Mol, CD) checkRoundTrips<si::Name>();
+
+int main() {
+    // All units of the library, the custom name of Volt is printed
+    SI_BASE_UNITS(SI_CHECK_ROUND_TRIPS)
+    SI_EXTENDED_UNITS(SI_CHECK_ROUND_TRIPS)
+
+    // Compound units: negative exponents, all base units and products of custom names
+    checkRoundTrip(si::Si<-1, 0, 0, 0, 0, 0, 0>{3.0});
+    checkRoundTrip(si::Si<1, -1, 2, -2, 3, -3, 1, int>{5});
+    checkRoundTrip(si::Si<2, 1, -3, 0, 0, 0, 0>{2.0});
+    checkRoundTrip(si::Volt<>{2.0} * si::Volt<>{3.0});
+    checkRoundTrip(si::Si<0, 0, -2, 0, 0, 0, 0, float>{8.0F});
+
+    // Prefixed names of literals
+    si::Meter<int> meterInt{};
+    SI_CHECK(parse("5 k_meter", meterInt) == std::errc{} && meterInt == si::Meter<int>{5000});
+    si::Second<> second{};
+    SI_CHECK(parse("3 mu_second", second) == std::errc{} && static_cast<double>(second) == 3 * 1e-6);
+    si::Speed<> speed{};
+    SI_CHECK(parse("10 k_meter / second", speed) == std::errc{} && speed == si::Speed<>{10000});
+    si::Si<2, 0, 0, 0, 0, 0, 0> area{};
+    SI_CHECK(parse("2 c_meter^2", area) == std::errc{} && static_cast<double>(area) == 2 * 1e-4);
+    si::Hertz<std::int64_t> hertz{};
+    SI_CHECK(parse("2 G_hertz", hertz) == std::errc{} && hertz == si::Hertz<std::int64_t>{2000000000});
+    si::Si<2, 1, -3, 0, 0, 0, 0> power{};
+    SI_CHECK(parse("2 V A", power) == std::errc{} && power == si::Si<2, 1, -3, 0, 0, 0, 0>{2});
+
+    // Errors: wrong unit, unknown name, values which do not fit
+    meterInt = si::Meter<int>{7};
+    SI_CHECK(parse("5 V", meterInt) == std::errc::invalid_argument);
+    SI_CHECK(parse("5 k_volt_meter", meterInt) == std::errc::invalid_argument);
+    SI_CHECK(parse("5 E_meter", meterInt) == std::errc::result_out_of_range);
+    SI_CHECK(parse("-3 G_meter", meterInt) == std::errc::result_out_of_range);
+    SI_CHECK(meterInt == si::Meter<int>{7});
+    si::Meter<std::int8_t> meterSmall{};
+    SI_CHECK(parse("2 h_meter", meterSmall) == std::errc::result_out_of_range);
+    SI_CHECK(parse("-1 h_meter", meterSmall) == std::errc{} && meterSmall == si::Meter<std::int8_t>{-100});
+    si::Meter<unsigned> meterUnsigned{};
+    SI_CHECK(parse("5 G_meter", meterUnsigned) == std::errc::result_out_of_range);
+    si::Meter<float> meterFloat{};
+    SI_CHECK(parse("1e30 Y_meter", meterFloat) == std::errc::result_out_of_range);
+
+    return si::test::result();
+}
@@ -0,0 +1,202 @@
+/**
+ * @file RingBufferTest.cpp
+ * @author paul
+ * @date 18.10.26
+ * @brief Tests of SiRingBuffer.hpp: values are popped in the order they were pushed, with multiple producers the
+ * values of every producer stay in order and no value is lost or duplicated.
+ * @ingroup SI
+ */
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <span>
+#include <thread>
+#include <vector>
+
+#include <SI/SiBase.hpp>
+#include <SI/SiRingBuffer.hpp>
+
+#include "Check.hpp"
+
+using Value = si::Second<std::int64_t>;
+
+/**
+ * Number of bits of a value used for the index, the remaining bits contain the producer.
+ */
+constexpr int indexBits = 32;
+
+/**
+ * Number of values pushed by every producer in the concurrent tests.
+ */
+constexpr std::int64_t valuesPerProducer = 100000;
+
+/**
+ * Value pushed by a producer.
+ * @param producer the number of the producer
+ * @param index the number of the value of the producer
+ * @return the value containing both numbers
+ */
+auto makeValue(std::int64_t producer, std::int64_t index) -> Value {
+    return Value{(producer << indexBits) | index};
+}
+
+/**
+ * Push values until all values are in the buffer, alternating between single pushes and bulk pushes of varying
+ * size.
+ * @tparam Buffer the type of the buffer
+ * @param buffer the buffer
+ * @param producer the number of the producer, part of the values
+ */
+template<typename Buffer>
+void produce(Buffer &buffer, std::int64_t producer) {
+    std::array<Value, 8> block{};
+    std::int64_t index = 0;
+    while (index < valuesPerProducer) {
+        if (index % 2 == 0) {
+            while (not buffer.push(makeValue(producer, index))) {
+                std::this_thread::yield();
+            }
+            ++index;
+        } else {
+            auto count = std::min<std::int64_t>(index % block.size() + 1, valuesPerProducer - index);
+            for (std::int64_t i = 0; i < count; ++i) {
+                block[i] = makeValue(producer, index + i);
+            }
+            std::span<const Value> rest{block.data(), static_cast<std::size_t>(count)};
+            while (not rest.empty()) {
+                auto pushed = buffer.push(rest);
+                rest = rest.subspan(pushed);
+                if (pushed == 0) {
+                    std::this_thread::yield();
+                }
+            }
+            index += count;
+        }
+    }
+}
+
+/**
+ * Pop the values of all producers, alternating between single pops and bulk pops, and check that the values of
+ * every producer arrive in order without gaps.
+ * @tparam Buffer the type of the buffer
+ * @param buffer the buffer
+ * @param producers the number of producers
+ */
+template<typename Buffer>
+void consume(Buffer &buffer, std::int64_t producers) {
+    std::vector<std::int64_t> next(producers, 0);
+    std::array<Value, 16> block{};
+    auto ordered = true;
+    auto check = [&](Value val) {
+        auto raw = static_cast<std::int64_t>(val);
+        auto producer = raw >> indexBits;
+        auto index = raw & ((std::int64_t{1} << indexBits) - 1);
+        if (producer < 0 or producer >= producers or index != next[producer]) {
+            ordered = false; // Continue consuming so the producers do not block
+            return;
+        }
+        ++next[producer];
+    };
+
+    auto remaining = producers * valuesPerProducer;
+    auto single = true;
+    while (remaining > 0) {
+        std::size_t popped = 0;
+        if (single) {
+            if (auto val = buffer.pop()) {
+                check(*val);
+                popped = 1;
+            }
+        } else {
+            popped = buffer.pop(std::span{block});
+            for (std::size_t i = 0; i < popped; ++i) {
+                check(block[i]);
+            }
+        }
+        if (popped == 0) {
+            std::this_thread::yield();
+        }
+        remaining -= static_cast<std::int64_t>(popped);
+        single = not single;
+    }
+
+    SI_CHECK(ordered);
+    for (auto count : next) {
+        SI_CHECK(count == valuesPerProducer);
+    }
+    SI_CHECK(buffer.empty());
+    SI_CHECK(not buffer.pop());
+}
+
+/**
+ * Single threaded checks of a buffer with capacity 8: full and empty buffers, partial bulk operations and the
+ * wrap around.
+ * @tparam Buffer the type of the buffer
+ */
+template<typename Buffer>
+void checkSequential() {
+    Buffer buffer;
+    SI_CHECK(buffer.empty());
+    SI_CHECK(not buffer.pop());
+
+    for (std::int64_t i = 0; i < 6; ++i) {
+        SI_CHECK(buffer.push(Value{i}));
+    }
+    std::array<Value, 4> out{};
+    SI_CHECK(buffer.pop(std::span{out}) == 4);
+    SI_CHECK(out[0] == Value{0} and out[3] == Value{3});
+
+    // The block wraps around the end of the storage, only the free slots are filled
+    std::array<Value, 8> in{};
+    for (std::int64_t i = 0; i < 8; ++i) {
+        in[i] = Value{6 + i};
+    }
+    SI_CHECK(buffer.push(std::span<const Value>{in}) == 6);
+    SI_CHECK(buffer.size() == 8);
+    SI_CHECK(not buffer.push(Value{100}));
+    SI_CHECK(buffer.push(std::span<const Value>{in}) == 0);
+
+    for (std::int64_t i = 4; i < 12; ++i) {
+        auto val = buffer.pop();
+        SI_CHECK(val and *val == Value{i});
+    }
+    SI_CHECK(buffer.empty());
+    SI_CHECK(buffer.pop(std::span{out}) == 0);
+}
+
+/**
+ * One producer and one consumer thread.
+ */
+void checkSpsc() {
+    si::RingBuffer<Value, 64> buffer;
+    std::thread producer{[&] { produce(buffer, 0); }};
+    consume(buffer, 1);
+    producer.join();
+}
+
+/**
+ * Multiple producer threads mixing single and bulk pushes. The capacity is small so the buffer is frequently full
+ * and the positions wrap around many times.
+ */
+void checkMpsc() {
+    constexpr std::int64_t producers = 4;
+    si::MpscRingBuffer<Value, 64> buffer;
+    std::vector<std::thread> threads;
+    for (std::int64_t p = 0; p < producers; ++p) {
+        threads.emplace_back([&buffer, p] { produce(buffer, p); });
+    }
+    consume(buffer, producers);
+    for (auto &thread : threads) {
+        thread.join();
+    }
+}
+
+auto main() -> int {
+    checkSequential<si::RingBuffer<Value, 8>>();
+    checkSequential<si::MpscRingBuffer<Value, 8>>();
+    checkSpsc();
+    checkMpsc();
+    return si::test::result();
+}
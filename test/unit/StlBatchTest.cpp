@@ -0,0 +1,119 @@
+/**
+ * @file StlBatchTest.cpp
+ * @author paul
+ * @date 18.10.26
+ * @brief Tests of SiStlBatch.hpp: the (possibly vectorized) functions give the same results as the scalar functions,
+ * atan2 within the documented error.
+ * @ingroup SI
+ */
+#include <algorithm>
+#include <bit>
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <random>
+#include <span>
+#include <vector>
+
+#include <SI/SiBase.hpp>
+#include <SI/SiStlBatch.hpp>
+
+#include "Check.hpp"
+
+/**
+ * Representation of a floating point value, used for comparisons which distinguish -0.0 and 0.0.
+ * @tparam T the floating point type
+ * @param val the value
+ * @return the bits of the value
+ */
+template<typename T>
+auto bits(T val) {
+    if constexpr (sizeof(T) == sizeof(std::uint64_t)) {
+        return std::bit_cast<std::uint64_t>(val);
+    } else {
+        return std::bit_cast<std::uint32_t>(val);
+    }
+}
+
+/**
+ * Checks that round gives bit identical results to std::round, including the sign of zero.
+ * @tparam T the underlying type
+ */
+template<typename T>
+void checkRound() {
+    constexpr auto inf = std::numeric_limits<T>::infinity();
+    std::vector<T> raw{T(-0.3),  std::nextafter(T(-0.5), T(0)), T(-0.5), T(-0.0), T(0.0), T(0.3), T(0.5), T(-1.5),
+                       T(-2.5),  T(2.5),                        T(1e7),  -inf,    inf,    T(-0.7), T(-1e-30)};
+    while (raw.size() % 8 != 0) { // Only complete registers are processed by the kernel
+        raw.push_back(T(-0.25));
+    }
+    std::vector<si::Meter<T>> in;
+    for (auto val : raw) {
+        in.emplace_back(val);
+    }
+    std::vector<si::Meter<T>> out(in.size());
+    si::round(std::span<const si::Meter<T>>{in}, std::span<si::Meter<T>>{out});
+    for (std::size_t i = 0; i < in.size(); ++i) {
+        SI_CHECK(bits(static_cast<T>(out[i])) == bits(std::round(raw[i])));
+    }
+    std::vector<si::Meter<T>> nan{8, si::Meter<T>{std::numeric_limits<T>::quiet_NaN()}};
+    si::round(std::span<const si::Meter<T>>{nan}, std::span<si::Meter<T>>{nan});
+    SI_CHECK(std::isnan(static_cast<T>(nan[0])));
+}
+
+/**
+ * Distance of two values in units in the last place.
+ * @param lhs the first value
+ * @param rhs the second value, same sign as lhs
+ * @return the number of representable values between lhs and rhs
+ */
+auto ulpDistance(double lhs, double rhs) -> std::int64_t {
+    auto diff = std::bit_cast<std::int64_t>(lhs) - std::bit_cast<std::int64_t>(rhs);
+    return diff < 0 ? -diff : diff;
+}
+
+/**
+ * Checks that atan2 is within 2 ulp of std::atan2 for random values and exact for special values.
+ */
+void checkAtan2() {
+    std::mt19937 gen{42};
+    std::uniform_real_distribution<double> dist{-100, 100};
+    std::vector<si::Meter<>> y(1U << 16U);
+    std::vector<si::Meter<>> x(y.size());
+    for (std::size_t i = 0; i < y.size(); ++i) {
+        y[i] = si::Meter<>{dist(gen)};
+        x[i] = si::Meter<>{dist(gen)};
+    }
+    constexpr auto inf = std::numeric_limits<double>::infinity();
+    const double special[][2] = {{0.0, -0.0}, {-0.0, -1.0}, {inf, -inf}, {-inf, 2.0}, {1.0, inf}, {-1.0, -inf}};
+    for (std::size_t i = 0; i < std::size(special); ++i) {
+        y[i] = si::Meter<>{special[i][0]};
+        x[i] = si::Meter<>{special[i][1]};
+    }
+    std::vector<double> out(y.size());
+    si::atan2(std::span<const si::Meter<>>{y}, std::span<const si::Meter<>>{x}, std::span<double>{out});
+    std::int64_t maxUlp = 0;
+    for (std::size_t i = 0; i < y.size(); ++i) {
+        auto expected = std::atan2(static_cast<double>(y[i]), static_cast<double>(x[i]));
+        if (i < std::size(special)) {
+            SI_CHECK(bits(out[i]) == bits(expected));
+        } else {
+            maxUlp = std::max(maxUlp, ulpDistance(out[i], expected));
+        }
+    }
+    SI_CHECK(maxUlp <= 2);
+
+    std::vector<si::Meter<float>> yFloat{8, si::Meter<float>{1}};
+    std::vector<si::Meter<float>> xFloat{8, si::Meter<float>{-1}};
+    std::vector<float> outFloat(8);
+    si::atan2(std::span<const si::Meter<float>>{yFloat}, std::span<const si::Meter<float>>{xFloat},
+              std::span<float>{outFloat});
+    SI_CHECK(std::abs(outFloat[7] - std::atan2(1.0F, -1.0F)) <= std::numeric_limits<float>::epsilon() * 4);
+}
+
+int main() {
+    checkRound<double>();
+    checkRound<float>();
+    checkAtan2();
+    return si::test::result();
+}
@@ -0,0 +1,101 @@
+/**
+ * @file WireTest.cpp
+ * @author paul
+ * @date 18.10.26
+ * @brief Tests of SiWire.hpp: values and batches are decoded as encoded, a descriptor of another unit or underlying
+ * type is rejected.
+ * @ingroup SI
+ */
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <vector>
+
+#include <SI/SiBase.hpp>
+#include <SI/SiExtended.hpp>
+#include <SI/SiWire.hpp>
+
+#include "Check.hpp"
+
+// Every underlying type has its own code
+static_assert(si::detail::typeCode<float> != si::detail::typeCode<std::int32_t>);
+static_assert(si::detail::typeCode<float> != si::detail::typeCode<std::uint32_t>);
+static_assert(si::detail::typeCode<std::int32_t> != si::detail::typeCode<std::uint32_t>);
+static_assert(si::detail::typeCode<double> != si::detail::typeCode<std::int64_t>);
+static_assert(si::detail::typeCode<std::int8_t> != si::detail::typeCode<std::uint8_t>);
+static_assert(si::detail::typeCode<std::int16_t> != si::detail::typeCode<std::int32_t>);
+
+/**
+ * Encode and decode a single value.
+ * @tparam SiT the SI type
+ * @param value the value
+ */
+template<typename SiT>
+void checkRoundTrip(SiT value) {
+    std::array<std::byte, 32> buffer{};
+    auto size = si::encode(value, buffer);
+    SI_CHECK(size == si::encodedSize<SiT>);
+    auto decoded = si::decode<SiT>(std::span{buffer}.first(size));
+    SI_CHECK(decoded.has_value() && *decoded == value);
+}
+
+/**
+ * Checks that a value encoded as From is not decoded as To.
+ * @tparam To the expected type when decoding
+ * @tparam From the encoded type
+ * @param value the encoded value
+ */
+template<typename To, typename From>
+void checkRejected(From value) {
+    std::array<std::byte, 32> buffer{};
+    auto size = si::encode(value, buffer);
+    SI_CHECK(not si::decode<To>(std::span{buffer}.first(size)).has_value());
+    SI_CHECK(not si::decodeBatch<To>(std::span{buffer}.first(size)).has_value());
+}
+
+int main() {
+    checkRoundTrip(si::Meter<>{1.5});
+    checkRoundTrip(si::Speed<float>{-2.25F});
+    checkRoundTrip(si::Volt<std::int8_t>{-7});
+    checkRoundTrip(si::Hertz<std::uint8_t>{200});
+    checkRoundTrip(si::Si<1, -1, 2, -2, 3, -3, 1, std::int64_t>{-1234567890123});
+    checkRoundTrip(si::Si<-128, 127, 0, 0, 0, 0, 0, std::uint16_t>{65535});
+
+    // Same unit, other underlying type (including types of the same size) and same type, other unit
+    checkRejected<si::Meter<float>>(si::Meter<double>{1});
+    checkRejected<si::Meter<std::int32_t>>(si::Meter<float>{1});
+    checkRejected<si::Meter<std::uint32_t>>(si::Meter<std::int32_t>{1});
+    checkRejected<si::Meter<std::int8_t>>(si::Meter<std::uint8_t>{2});
+    checkRejected<si::Meter<std::int64_t>>(si::Meter<std::int32_t>{1});
+    checkRejected<si::Second<>>(si::Meter<>{1});
+    checkRejected<si::Si<1, 0, 0, 0, 0, 0, 1>>(si::Meter<>{1});
+
+    // Buffers which are too small
+    std::array<std::byte, 32> buffer{};
+    SI_CHECK(si::encode(si::Meter<>{1}, std::span{buffer}.first(15)) == 0);
+    auto size = si::encode(si::Meter<>{1}, buffer);
+    SI_CHECK(not si::decode<si::Meter<>>(std::span{buffer}.first(size - 1)).has_value());
+
+    // Batches
+    std::vector<si::Meter<float>> values{si::Meter<float>{1}, si::Meter<float>{-2}, si::Meter<float>{3.5F}};
+    alignas(8) std::array<std::byte, 64> batchBuffer{};
+    auto batchSize = si::encodeBatch(std::span<const si::Meter<float>>{values}, batchBuffer);
+    SI_CHECK(batchSize == si::encodedBatchSize<si::Meter<float>>(values.size()));
+    auto batch = si::decodeBatch<si::Meter<float>>(std::span{batchBuffer}.first(batchSize));
+    SI_CHECK(batch.has_value() && batch->size() == values.size());
+    if (batch) {
+        std::vector<si::Meter<float>> copy(batch->size());
+        batch->copyTo(copy);
+        SI_CHECK(copy == values);
+        SI_CHECK((*batch)[1] == si::Meter<float>{-2});
+        auto inPlace = batch->span();
+        SI_CHECK(not inPlace || (inPlace->size() == 3 && (*inPlace)[2] == si::Meter<float>{3.5F}));
+    }
+    SI_CHECK(not si::decodeBatch<si::Meter<>>(std::span{batchBuffer}.first(batchSize)).has_value());
+    SI_CHECK(not si::decodeBatch<si::Meter<float>>(std::span{batchBuffer}.first(batchSize - 1)).has_value());
+    batchBuffer[si::detail::descriptorSize + 4] = std::byte{1}; // Reserved bytes need to be zero
+    SI_CHECK(not si::decodeBatch<si::Meter<float>>(std::span{batchBuffer}.first(batchSize)).has_value());
+
+    return si::test::result();
+}